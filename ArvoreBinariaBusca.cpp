@@ -32,10 +32,12 @@ ArvoreBinariaBusca::No *ArvoreBinariaBusca::inserirRecursivo(No *no, Elemento *e
     if (elemento->getID() < no->elemento->getID())
     {
         no->esquerdo = inserirRecursivo(no->esquerdo, elemento);
+        no->esquerdo->pai = no;
     }
     else if (elemento->getID() > no->elemento->getID())
     {
         no->direito = inserirRecursivo(no->direito, elemento);
+        no->direito->pai = no;
     }
     else
     {
@@ -76,6 +78,8 @@ Elemento *ArvoreBinariaBusca::buscarRecursivo(No *no, int id) const
 
 /**
  * Método auxiliar recursivo para remover um elemento
+ * Apenas desliga o nó: o elemento não é liberado, pois é devolvido a quem
+ * chamou removerPeloId
  * Complexidade: O(log n) no caso médio, O(n) no pior caso
  */
 ArvoreBinariaBusca::No *ArvoreBinariaBusca::removerRecursivo(No *no, int id)
@@ -90,10 +94,18 @@ ArvoreBinariaBusca::No *ArvoreBinariaBusca::removerRecursivo(No *no, int id)
     if (id < no->elemento->getID())
     {
         no->esquerdo = removerRecursivo(no->esquerdo, id);
+        if (no->esquerdo != nullptr)
+        {
+            no->esquerdo->pai = no;
+        }
     }
     else if (id > no->elemento->getID())
     {
         no->direito = removerRecursivo(no->direito, id);
+        if (no->direito != nullptr)
+        {
+            no->direito->pai = no;
+        }
     }
     else
     {
@@ -103,14 +115,12 @@ ArvoreBinariaBusca::No *ArvoreBinariaBusca::removerRecursivo(No *no, int id)
         if (no->esquerdo == nullptr)
         {
             No *temp = no->direito;
-            delete no->elemento;
             delete no;
             return temp;
         }
         else if (no->direito == nullptr)
         {
             No *temp = no->esquerdo;
-            delete no->elemento;
             delete no;
             return temp;
         }
@@ -119,12 +129,15 @@ ArvoreBinariaBusca::No *ArvoreBinariaBusca::removerRecursivo(No *no, int id)
         // Encontra o sucessor em ordem (menor valor da subárvore direita)
         No *sucessor = encontrarMinimo(no->direito);
 
-        // Substitui o elemento do nó atual pelo do sucessor
-        delete no->elemento;
+        // O nó atual passa a guardar o elemento do sucessor
         no->elemento = sucessor->elemento;
 
-        // Remove o sucessor (que agora é duplicado)
+        // Remove o nó do sucessor (que agora é duplicado)
         no->direito = removerRecursivo(no->direito, sucessor->elemento->getID());
+        if (no->direito != nullptr)
+        {
+            no->direito->pai = no;
+        }
     }
 
     return no;
@@ -143,6 +156,78 @@ ArvoreBinariaBusca::No *ArvoreBinariaBusca::encontrarMinimo(No *no) const
     return no;
 }
 
+/**
+ * Método auxiliar para encontrar o sucessor em ordem de um nó
+ * Complexidade: O(1) amortizado em um percurso completo, O(altura) no pior caso
+ */
+const ArvoreBinariaBusca::No *ArvoreBinariaBusca::sucessor(const No *no)
+{
+    if (no->direito != nullptr)
+    {
+        no = no->direito;
+        while (no->esquerdo != nullptr)
+        {
+            no = no->esquerdo;
+        }
+        return no;
+    }
+
+    // Sobe enquanto o nó for filho direito: o sucessor é o primeiro ancestral
+    // do qual o nó está na subárvore esquerda
+    while (no->pai != nullptr && no == no->pai->direito)
+    {
+        no = no->pai;
+    }
+    return no->pai;
+}
+
+/**
+ * Método auxiliar recursivo para visitar os nós em ordem
+ * Complexidade: O(n) - Visita todos os nós
+ */
+void ArvoreBinariaBusca::paraCadaRecursivo(No *no, const std::function<void(const Elemento *)> &visitante) const
+{
+    if (no != nullptr)
+    {
+        paraCadaRecursivo(no->esquerdo, visitante);
+        visitante(no->elemento);
+        paraCadaRecursivo(no->direito, visitante);
+    }
+}
+
+/**
+ * Método auxiliar recursivo para visitar em ordem os elementos de um intervalo
+ * Complexidade: O(altura + k)
+ */
+int ArvoreBinariaBusca::buscarIntervaloRecursivo(No *no, int idMin, int idMax,
+                                                 const std::function<void(const Elemento *)> &visitante) const
+{
+    if (no == nullptr)
+    {
+        return 0;
+    }
+
+    int visitados = 0;
+    int id = no->elemento->getID();
+
+    // Só há IDs >= idMin à esquerda se o nó atual ainda é maior que idMin
+    if (id > idMin)
+    {
+        visitados += buscarIntervaloRecursivo(no->esquerdo, idMin, idMax, visitante);
+    }
+    if (id >= idMin && id <= idMax)
+    {
+        visitante(no->elemento);
+        visitados++;
+    }
+    // Só há IDs <= idMax à direita se o nó atual ainda é menor que idMax
+    if (id < idMax)
+    {
+        visitados += buscarIntervaloRecursivo(no->direito, idMin, idMax, visitante);
+    }
+    return visitados;
+}
+
 /**
  * Método auxiliar recursivo para percurso em ordem
  * Complexidade: O(n) - Visita todos os nós
@@ -221,6 +306,7 @@ bool ArvoreBinariaBusca::inserir(Elemento *elemento)
     }
 
     raiz = inserirRecursivo(raiz, elemento);
+    raiz->pai = nullptr;
     tamanho++;
     return true;
 }
@@ -245,6 +331,10 @@ Elemento *ArvoreBinariaBusca::removerPeloId(int id)
     if (elementoRemovido != nullptr)
     {
         raiz = removerRecursivo(raiz, id);
+        if (raiz != nullptr)
+        {
+            raiz->pai = nullptr;
+        }
         tamanho--;
     }
 
@@ -304,3 +394,35 @@ void ArvoreBinariaBusca::posOrdem() const
     posOrdemRecursivo(raiz);
     std::cout << "Total de elementos: " << tamanho << std::endl;
 }
+
+/**
+ * Visita todos os elementos em ordem crescente de ID
+ * Complexidade: O(n) - Visita todos os nós
+ */
+void ArvoreBinariaBusca::paraCada(const std::function<void(const Elemento *)> &visitante) const
+{
+    paraCadaRecursivo(raiz, visitante);
+}
+
+/**
+ * Visita, em ordem crescente de ID, os elementos com ID em [idMin, idMax]
+ * Complexidade: O(log n + k) no caso médio, O(n) no pior caso
+ */
+int ArvoreBinariaBusca::buscarIntervalo(int idMin, int idMax,
+                                        const std::function<void(const Elemento *)> &visitante) const
+{
+    if (idMax < idMin)
+    {
+        return 0;
+    }
+    return buscarIntervaloRecursivo(raiz, idMin, idMax, visitante);
+}
+
+/**
+ * Iterador para o elemento de menor ID
+ * Complexidade: O(log n) no caso médio, O(n) no pior caso
+ */
+ArvoreBinariaBusca::Iterador ArvoreBinariaBusca::begin() const
+{
+    return Iterador(raiz != nullptr ? encontrarMinimo(raiz) : nullptr);
+}
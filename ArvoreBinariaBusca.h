@@ -2,11 +2,16 @@
 #define ARVORE_BINARIA_BUSCA_H
 
 #include "Elemento.h"
+#include <cstddef>
+#include <functional>
+#include <iterator>
 
 /**
  * Classe que implementa uma Árvore Binária de Busca com alocação dinâmica.
  * Demonstra o pilar do Encapsulamento ao esconder completamente a implementação dos nós.
  * Mantém a propriedade fundamental: nó esquerdo < nó pai < nó direito.
+ * Cada nó guarda também o seu pai, o que permite percorrer a árvore em ordem
+ * com um iterador sem pilha auxiliar.
  */
 class ArvoreBinariaBusca
 {
@@ -21,15 +26,17 @@ private:
         Elemento *elemento;
         No *esquerdo;
         No *direito;
+        No *pai;
 
         /**
          * Construtor do nó
          * @param elem Ponteiro para o elemento
          * @param esq Ponteiro para o nó esquerdo
          * @param dir Ponteiro para o nó direito
+         * @param p Ponteiro para o nó pai
          */
-        No(Elemento *elem, No *esq = nullptr, No *dir = nullptr)
-            : elemento(elem), esquerdo(esq), direito(dir) {}
+        No(Elemento *elem, No *esq = nullptr, No *dir = nullptr, No *p = nullptr)
+            : elemento(elem), esquerdo(esq), direito(dir), pai(p) {}
     };
 
     No *raiz;    // Ponteiro para o nó raiz
@@ -70,6 +77,37 @@ private:
      */
     No *encontrarMinimo(No *no) const;
 
+    /**
+     * Método auxiliar para encontrar o sucessor em ordem de um nó
+     * Sobe pelos pais quando o nó não tem subárvore direita
+     * @param no Ponteiro para o nó atual
+     * @return Ponteiro para o próximo nó em ordem ou nullptr se é o último
+     * Complexidade: O(1) amortizado em um percurso completo, O(altura) no pior caso
+     */
+    static const No *sucessor(const No *no);
+
+    /**
+     * Método auxiliar recursivo para visitar os nós em ordem
+     * @param no Ponteiro para o nó atual
+     * @param visitante Função chamada para cada elemento
+     * Complexidade: O(n) - Visita todos os nós
+     */
+    void paraCadaRecursivo(No *no, const std::function<void(const Elemento *)> &visitante) const;
+
+    /**
+     * Método auxiliar recursivo para visitar em ordem os elementos com ID em [idMin, idMax]
+     * Só desce para a esquerda se ainda pode haver IDs >= idMin ali, e para a
+     * direita se ainda pode haver IDs <= idMax
+     * @param no Ponteiro para o nó atual
+     * @param idMin Menor ID do intervalo
+     * @param idMax Maior ID do intervalo
+     * @param visitante Função chamada para cada elemento do intervalo
+     * @return Número de elementos visitados nesta subárvore
+     * Complexidade: O(altura + k), com k o número de elementos no intervalo
+     */
+    int buscarIntervaloRecursivo(No *no, int idMin, int idMax,
+                                 const std::function<void(const Elemento *)> &visitante) const;
+
     /**
      * Método auxiliar recursivo para percurso em ordem
      * @param no Ponteiro para o nó atual
@@ -99,6 +137,44 @@ private:
     void destruirArvore(No *no);
 
 public:
+    /**
+     * Iterador constante compatível com a STL (forward iterator), que percorre
+     * os elementos em ordem crescente de ID usando os ponteiros para o pai
+     * Complexidade: O(1) amortizado por avanço
+     */
+    class Iterador
+    {
+    private:
+        const No *atual; // Nó atual (nullptr no fim)
+
+        explicit Iterador(const No *no) : atual(no) {}
+        friend class ArvoreBinariaBusca;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Elemento *value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Elemento *const *pointer;
+        typedef Elemento *const &reference;
+
+        Iterador() : atual(nullptr) {}
+        reference operator*() const { return atual->elemento; }
+        pointer operator->() const { return &atual->elemento; }
+        Iterador &operator++()
+        {
+            atual = sucessor(atual);
+            return *this;
+        }
+        Iterador operator++(int)
+        {
+            Iterador anterior = *this;
+            atual = sucessor(atual);
+            return anterior;
+        }
+        bool operator==(const Iterador &outro) const { return atual == outro.atual; }
+        bool operator!=(const Iterador &outro) const { return atual != outro.atual; }
+    };
+
     /**
      * Construtor da Árvore Binária de Busca
      */
@@ -165,6 +241,37 @@ public:
      * Complexidade: O(1)
      */
     int getTamanho() const { return tamanho; }
+
+    /**
+     * Visita todos os elementos em ordem crescente de ID, sem cópias nem impressão
+     * @param visitante Função chamada uma vez para cada elemento
+     * Complexidade: O(n) - Visita todos os nós
+     */
+    void paraCada(const std::function<void(const Elemento *)> &visitante) const;
+
+    /**
+     * Visita, em ordem crescente de ID, os elementos com ID em [idMin, idMax]
+     * As subárvores inteiramente fora do intervalo não são visitadas
+     * @param idMin Menor ID do intervalo
+     * @param idMax Maior ID do intervalo (se idMax < idMin, nada é visitado)
+     * @param visitante Função chamada uma vez para cada elemento do intervalo
+     * @return Número de elementos visitados
+     * Complexidade: O(log n + k) no caso médio, O(n) no pior caso, com k o
+     * número de elementos no intervalo
+     */
+    int buscarIntervalo(int idMin, int idMax, const std::function<void(const Elemento *)> &visitante) const;
+
+    /**
+     * Iterador para o elemento de menor ID
+     * Complexidade: O(log n) no caso médio, O(n) no pior caso
+     */
+    Iterador begin() const;
+
+    /**
+     * Iterador para depois do elemento de maior ID
+     * Complexidade: O(1)
+     */
+    Iterador end() const { return Iterador(); }
 };
 
 #endif // ARVORE_BINARIA_BUSCA_H
@@ -61,23 +61,7 @@ Elemento *Deque::removerTras()
  */
 Elemento *Deque::consultarFrente() const
 {
-    if (dequeVazio())
-    {
-        return nullptr;
-    }
-
-    // Para acessar o primeiro elemento, usamos o mesmo truque das outras estruturas
-    // Removemos temporariamente e inserimos de volta
-    ListaDuplamenteEncadeada *listaTemp = const_cast<ListaDuplamenteEncadeada *>(&lista);
-
-    Elemento *frente = listaTemp->removerPrimeiro();
-
-    if (frente != nullptr)
-    {
-        listaTemp->inserirNoInicio(frente);
-    }
-
-    return frente;
+    return lista.primeiro();
 }
 
 /**
@@ -86,23 +70,7 @@ Elemento *Deque::consultarFrente() const
  */
 Elemento *Deque::consultarTras() const
 {
-    if (dequeVazio())
-    {
-        return nullptr;
-    }
-
-    // Para acessar o último elemento, usamos o mesmo truque
-    // Removemos temporariamente e inserimos de volta
-    ListaDuplamenteEncadeada *listaTemp = const_cast<ListaDuplamenteEncadeada *>(&lista);
-
-    Elemento *tras = listaTemp->removerUltimo();
-
-    if (tras != nullptr)
-    {
-        listaTemp->inserirNoFim(tras);
-    }
-
-    return tras;
+    return lista.ultimo();
 }
 
 /**
@@ -163,3 +131,30 @@ void Deque::imprimirDequeReverso() const
     lista.imprimirTodosReverso();
     std::cout << "Tamanho do deque: " << getTamanho() << std::endl;
 }
+
+/**
+ * Visita todos os elementos da frente para trás
+ * Complexidade: O(n) - Delega para a lista subjacente
+ */
+void Deque::paraCada(const std::function<void(const Elemento *)> &visitante) const
+{
+    lista.paraCada(visitante);
+}
+
+/**
+ * Iterador para o elemento da frente
+ * Complexidade: O(1)
+ */
+Deque::Iterador Deque::begin() const
+{
+    return lista.begin();
+}
+
+/**
+ * Iterador para depois do elemento de trás
+ * Complexidade: O(1)
+ */
+Deque::Iterador Deque::end() const
+{
+    return lista.end();
+}
@@ -15,6 +15,12 @@ private:
     ListaDuplamenteEncadeada lista; // Composição: usa uma lista para implementar o deque
 
 public:
+    /**
+     * Iterador constante compatível com a STL: reutiliza o iterador da lista
+     * subjacente, percorrendo da frente para trás
+     */
+    typedef ListaDuplamenteEncadeada::Iterador Iterador;
+
     /**
      * Construtor do Deque
      */
@@ -94,6 +100,25 @@ public:
      * Complexidade: O(n)
      */
     void imprimirDequeReverso() const;
+
+    /**
+     * Visita todos os elementos da frente para trás, sem cópias nem impressão
+     * @param visitante Função chamada uma vez para cada elemento
+     * Complexidade: O(n) - Delega para a lista subjacente
+     */
+    void paraCada(const std::function<void(const Elemento *)> &visitante) const;
+
+    /**
+     * Iterador para o elemento da frente
+     * Complexidade: O(1)
+     */
+    Iterador begin() const;
+
+    /**
+     * Iterador para depois do elemento de trás
+     * Complexidade: O(1)
+     */
+    Iterador end() const;
 };
 
 #endif // DEQUE_H
@@ -4,7 +4,7 @@
 /**
  * Enfileira um elemento (adiciona no final)
  * Usa inserirNoFinal da lista para ter complexidade O(1)
- * Complexidade: O(1) - Inserção no final da lista
+ * Complexidade: O(1) amortizado - Inserção no final da lista
  */
 bool Fila::enfileirar(Elemento *elemento)
 {
@@ -19,33 +19,23 @@ bool Fila::enfileirar(Elemento *elemento)
 
 /**
  * Desenfileira um elemento (remove do início)
- * Usa removerPrimeiro da lista, que tem complexidade O(n) - INEFICIENTE
- * Complexidade: O(n) - Remoção do início da lista
+ * Usa removerPrimeiro da lista, que avança o início do array circular
+ * Complexidade: O(1) - Remoção do início da lista circular
  */
 Elemento *Fila::desenfileirar()
 {
-    // Usa removerPrimeiro que tem complexidade O(n) - PROBLEMA!
+    // removerPrimeiro é O(1): a lista não desloca os elementos restantes
     return lista.removerPrimeiro();
 }
 
 /**
  * Consulta o elemento da frente sem removê-lo
- * Complexidade: Depende da implementação da lista para acessar o primeiro elemento
+ * Complexidade: O(1) - Acesso direto ao início do array circular
  */
 Elemento *Fila::consultarFrente() const
 {
-    if (filaVazia())
-    {
-        return nullptr;
-    }
-
-    // Para acessar o primeiro elemento, precisamos usar busca
-    // Como não temos acesso direto por índice, esta operação é ineficiente
-    // Idealmente, a lista deveria ter um método para acessar por índice
-
-    // Implementação simplificada: assumindo que temos acesso ao primeiro elemento
-    // Na prática, seria necessário modificar a lista para ter acesso direto
-    return nullptr; // Placeholder
+    // A frente é o primeiro elemento, no início do array circular
+    return lista.primeiro();
 }
 
 /**
@@ -93,6 +83,6 @@ void Fila::imprimirFila() const
     lista.imprimirTodos();
     std::cout << "Tamanho da fila: " << getTamanho() << std::endl;
 
-    std::cout << "\nNOTA: Esta implementação de fila apresenta ineficiência na operação" << std::endl;
-    std::cout << "de desenfileirar (O(n)) devido ao uso de removerPrimeiro() da lista." << std::endl;
+    std::cout << "\nNOTA: Esta implementação de fila desenfileira em O(1), pois a lista" << std::endl;
+    std::cout << "subjacente usa o array de forma circular em removerPrimeiro()." << std::endl;
 }
@@ -8,8 +8,8 @@
  * Demonstra o pilar da Composição e Encapsulamento.
  * Segue o padrão FIFO (First In, First Out).
  *
- * NOTA: Esta implementação apresenta ineficiência na operação de desenfileirar,
- * pois usa removerPrimeiro() que tem complexidade O(n).
+ * NOTA: desenfileirar usa removerPrimeiro(), que é O(1) porque a ListaNaoOrdenada
+ * usa o array de forma circular (avança o início em vez de deslocar os elementos).
  */
 class Fila
 {
@@ -31,14 +31,14 @@ public:
      * Enfileira um elemento (adiciona no final)
      * @param elemento Ponteiro para o elemento a ser enfileirado
      * @return true se enfileirado com sucesso, false caso contrário
-     * Complexidade: O(1) - Inserção no final da lista
+     * Complexidade: O(1) amortizado - Inserção no final da lista
      */
     bool enfileirar(Elemento *elemento);
 
     /**
      * Desenfileira um elemento (remove do início)
      * @return Ponteiro para o elemento desenfileirado ou nullptr se vazia
-     * Complexidade: O(n) - Remoção do início da lista (INEFICIENTE)
+     * Complexidade: O(1) - Remoção do início da lista circular
      */
     Elemento *desenfileirar();
 
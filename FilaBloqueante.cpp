@@ -0,0 +1,231 @@
+#include "FilaBloqueante.h"
+
+/**
+ * Construtor da Fila Bloqueante
+ * Complexidade: O(1)
+ */
+FilaBloqueante::FilaBloqueante(int capacidadeMaxima)
+    : capacidadeMaxima(capacidadeMaxima > 0 ? capacidadeMaxima : 0),
+      encerrada(false),
+      consumidoresEsperando(0),
+      produtoresEsperando(0)
+{
+}
+
+/**
+ * Destrutor da Fila Bloqueante
+ * Complexidade: O(n) - Precisa deletar todos os elementos
+ */
+FilaBloqueante::~FilaBloqueante()
+{
+    Elemento *elemento;
+    while ((elemento = fila.desenfileirar()) != nullptr)
+    {
+        delete elemento;
+    }
+}
+
+/**
+ * Espera até haver elementos, a fila ser encerrada ou o prazo vencer
+ * O contador de consumidores em espera permite aos produtores pular a
+ * notificação quando ninguém está dormindo
+ * Complexidade: O(1) fora a espera
+ */
+bool FilaBloqueante::esperarElementos(std::unique_lock<std::mutex> &trava,
+                                      const std::chrono::steady_clock::time_point *limite)
+{
+    while (fila.filaVazia() && !encerrada)
+    {
+        consumidoresEsperando++;
+        bool noPrazo = true;
+        if (limite == nullptr)
+        {
+            naoVazia.wait(trava);
+        }
+        else
+        {
+            noPrazo = naoVazia.wait_until(trava, *limite) == std::cv_status::no_timeout;
+        }
+        consumidoresEsperando--;
+
+        if (!noPrazo)
+        {
+            break;
+        }
+    }
+    return !fila.filaVazia();
+}
+
+/**
+ * Retira o elemento da frente e avisa um produtor que espera por espaço
+ * Complexidade: O(1)
+ */
+Elemento *FilaBloqueante::retirarUm()
+{
+    Elemento *elemento = fila.desenfileirar();
+    if (produtoresEsperando > 0)
+    {
+        naoCheia.notify_one();
+    }
+    return elemento;
+}
+
+/**
+ * Retira até "maximo" elementos e avisa os produtores que esperam por espaço
+ * Complexidade: O(k)
+ */
+int FilaBloqueante::retirarLote(std::vector<Elemento *> &saida, int maximo)
+{
+    int retirados = 0;
+    while (retirados < maximo && !fila.filaVazia())
+    {
+        saida.push_back(fila.desenfileirar());
+        retirados++;
+    }
+
+    if (produtoresEsperando > 0 && retirados > 0)
+    {
+        if (retirados == 1)
+        {
+            naoCheia.notify_one();
+        }
+        else
+        {
+            naoCheia.notify_all();
+        }
+    }
+    return retirados;
+}
+
+/**
+ * Enfileira um elemento, esperando por espaço se a fila for limitada
+ * Complexidade: O(1) fora a espera
+ */
+bool FilaBloqueante::enfileirar(Elemento *elemento)
+{
+    if (elemento == nullptr)
+    {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> trava(mutex);
+    while (cheia() && !encerrada)
+    {
+        produtoresEsperando++;
+        naoCheia.wait(trava);
+        produtoresEsperando--;
+    }
+    if (encerrada || !fila.enfileirar(elemento))
+    {
+        return false;
+    }
+
+    if (consumidoresEsperando > 0)
+    {
+        naoVazia.notify_one();
+    }
+    return true;
+}
+
+/**
+ * Desenfileira um elemento, esperando enquanto a fila estiver vazia
+ * Complexidade: O(1) fora a espera
+ */
+Elemento *FilaBloqueante::desenfileirar()
+{
+    std::unique_lock<std::mutex> trava(mutex);
+    if (!esperarElementos(trava, nullptr))
+    {
+        return nullptr;
+    }
+    return retirarUm();
+}
+
+/**
+ * Desenfileira um elemento, esperando no máximo o tempo informado
+ * Complexidade: O(1) fora a espera
+ */
+Elemento *FilaBloqueante::desenfileirar(std::chrono::milliseconds tempoMaximo)
+{
+    std::chrono::steady_clock::time_point limite = std::chrono::steady_clock::now() + tempoMaximo;
+    std::unique_lock<std::mutex> trava(mutex);
+    if (!esperarElementos(trava, &limite))
+    {
+        return nullptr;
+    }
+    return retirarUm();
+}
+
+/**
+ * Desenfileira de uma vez até "maximo" elementos, esperando enquanto a fila
+ * estiver vazia
+ * Complexidade: O(k) fora a espera
+ */
+int FilaBloqueante::desenfileirarLote(std::vector<Elemento *> &saida, int maximo)
+{
+    if (maximo <= 0)
+    {
+        return 0;
+    }
+
+    std::unique_lock<std::mutex> trava(mutex);
+    if (!esperarElementos(trava, nullptr))
+    {
+        return 0;
+    }
+    return retirarLote(saida, maximo);
+}
+
+/**
+ * Desenfileira de uma vez até "maximo" elementos, esperando no máximo o
+ * tempo informado
+ * Complexidade: O(k) fora a espera
+ */
+int FilaBloqueante::desenfileirarLote(std::vector<Elemento *> &saida, int maximo,
+                                      std::chrono::milliseconds tempoMaximo)
+{
+    if (maximo <= 0)
+    {
+        return 0;
+    }
+
+    std::chrono::steady_clock::time_point limite = std::chrono::steady_clock::now() + tempoMaximo;
+    std::unique_lock<std::mutex> trava(mutex);
+    if (!esperarElementos(trava, &limite))
+    {
+        return 0;
+    }
+    return retirarLote(saida, maximo);
+}
+
+/**
+ * Encerra a fila e acorda todas as threads em espera
+ * Complexidade: O(1)
+ */
+void FilaBloqueante::encerrar()
+{
+    std::lock_guard<std::mutex> trava(mutex);
+    encerrada = true;
+    naoVazia.notify_all();
+    naoCheia.notify_all();
+}
+
+/**
+ * Verifica se a fila foi encerrada
+ * Complexidade: O(1)
+ */
+bool FilaBloqueante::estaEncerrada() const
+{
+    std::lock_guard<std::mutex> trava(mutex);
+    return encerrada;
+}
+
+/**
+ * Obtém o número de elementos na fila
+ * Complexidade: O(1)
+ */
+int FilaBloqueante::getTamanho() const
+{
+    std::lock_guard<std::mutex> trava(mutex);
+    return fila.getTamanho();
+}
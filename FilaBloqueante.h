@@ -0,0 +1,160 @@
+#ifndef FILA_BLOQUEANTE_H
+#define FILA_BLOQUEANTE_H
+
+#include "FilaEncadeada.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+/**
+ * Classe Fila Bloqueante: fila produtor/consumidor segura para várias threads,
+ * implementada usando composição com FilaEncadeada protegida por um mutex.
+ * Em vez de consultar filaVazia() em laço, o consumidor dorme em uma variável
+ * de condição até haver elementos (ou até o tempo máximo informado), e
+ * desenfileirarLote entrega de uma vez até N elementos por despertar, o que
+ * divide o custo da trava e da troca de contexto por todo o lote.
+ * Opcionalmente, a fila é limitada: com ela cheia, o produtor dorme em uma
+ * segunda variável de condição até um consumidor abrir espaço.
+ * As notificações só são feitas quando há alguma thread esperando do outro lado.
+ * encerrar() acorda todas as threads: a partir daí nada mais entra, e os
+ * consumidores recebem os elementos restantes e depois nullptr (ou lote vazio).
+ * Demonstra o pilar da Composição e Encapsulamento.
+ */
+class FilaBloqueante
+{
+private:
+    FilaEncadeada fila;                         // Composição: elementos em ordem FIFO
+    int capacidadeMaxima;                       // Limite de elementos (0 se ilimitada)
+    bool encerrada;                             // Se encerrar() já foi chamado
+    int consumidoresEsperando;                  // Threads dormindo em naoVazia
+    int produtoresEsperando;                    // Threads dormindo em naoCheia
+    mutable std::mutex mutex;                   // Protege todos os campos acima
+    std::condition_variable naoVazia;           // Sinalizada quando entra um elemento
+    std::condition_variable naoCheia;           // Sinalizada quando sai um elemento (fila limitada)
+
+    /**
+     * Verifica se a fila atingiu o limite (com o mutex travado)
+     * Complexidade: O(1)
+     */
+    bool cheia() const { return capacidadeMaxima > 0 && fila.getTamanho() >= capacidadeMaxima; }
+
+    /**
+     * Espera, com o mutex travado, até haver elementos, a fila ser encerrada ou
+     * o prazo vencer
+     * @param trava Trava do mutex da fila
+     * @param limite Prazo (nullptr para esperar sem limite)
+     * @return true se há elementos para desenfileirar
+     * Complexidade: O(1) fora a espera
+     */
+    bool esperarElementos(std::unique_lock<std::mutex> &trava,
+                          const std::chrono::steady_clock::time_point *limite);
+
+    /**
+     * Retira o elemento da frente, com o mutex travado e a fila não vazia, e
+     * avisa um produtor que espera por espaço
+     * @return Elemento retirado
+     * Complexidade: O(1)
+     */
+    Elemento *retirarUm();
+
+    /**
+     * Retira até "maximo" elementos, com o mutex travado, e avisa os produtores
+     * que esperam por espaço
+     * @return Número de elementos acrescentados a saida
+     * Complexidade: O(k)
+     */
+    int retirarLote(std::vector<Elemento *> &saida, int maximo);
+
+public:
+    /**
+     * Construtor da Fila Bloqueante
+     * @param capacidadeMaxima Número máximo de elementos (0 para ilimitada)
+     */
+    explicit FilaBloqueante(int capacidadeMaxima = 0);
+
+    /**
+     * Destrutor da Fila Bloqueante (nenhuma thread pode estar usando a fila)
+     * Libera os elementos que ainda estiverem nela
+     */
+    ~FilaBloqueante();
+
+    FilaBloqueante(const FilaBloqueante &) = delete;
+    FilaBloqueante &operator=(const FilaBloqueante &) = delete;
+
+    /**
+     * Enfileira um elemento, esperando por espaço se a fila for limitada e
+     * estiver cheia
+     * @param elemento Ponteiro para o elemento a ser enfileirado
+     * @return true se enfileirado, false se o elemento é nulo ou a fila foi encerrada
+     * Complexidade: O(1) fora a espera
+     */
+    bool enfileirar(Elemento *elemento);
+
+    /**
+     * Desenfileira um elemento, esperando enquanto a fila estiver vazia
+     * @return Ponteiro para o elemento ou nullptr se a fila foi encerrada e esvaziada
+     * Complexidade: O(1) fora a espera
+     */
+    Elemento *desenfileirar();
+
+    /**
+     * Desenfileira um elemento, esperando no máximo o tempo informado
+     * @param tempoMaximo Tempo máximo de espera
+     * @return Ponteiro para o elemento ou nullptr se o prazo venceu ou a fila
+     * foi encerrada e esvaziada
+     * Complexidade: O(1) fora a espera
+     */
+    Elemento *desenfileirar(std::chrono::milliseconds tempoMaximo);
+
+    /**
+     * Desenfileira de uma vez até "maximo" elementos, esperando enquanto a
+     * fila estiver vazia: um único despertar e uma única trava para o lote
+     * @param saida Vetor ao qual os elementos são acrescentados, em ordem FIFO
+     * @param maximo Número máximo de elementos a retirar
+     * @return Número de elementos retirados (0 se maximo <= 0 ou a fila foi
+     * encerrada e esvaziada)
+     * Complexidade: O(k), com k o número de elementos retirados, fora a espera
+     */
+    int desenfileirarLote(std::vector<Elemento *> &saida, int maximo);
+
+    /**
+     * Desenfileira de uma vez até "maximo" elementos, esperando no máximo o
+     * tempo informado
+     * @param saida Vetor ao qual os elementos são acrescentados, em ordem FIFO
+     * @param maximo Número máximo de elementos a retirar
+     * @param tempoMaximo Tempo máximo de espera
+     * @return Número de elementos retirados (0 se o prazo venceu)
+     * Complexidade: O(k) fora a espera
+     */
+    int desenfileirarLote(std::vector<Elemento *> &saida, int maximo, std::chrono::milliseconds tempoMaximo);
+
+    /**
+     * Encerra a fila: acorda todas as threads em espera e recusa novos elementos
+     * Complexidade: O(1)
+     */
+    void encerrar();
+
+    /**
+     * Verifica se a fila foi encerrada
+     * @return true se encerrada, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool estaEncerrada() const;
+
+    /**
+     * Obtém o número de elementos na fila (pode mudar logo depois de lido)
+     * @return Número de elementos na fila
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * Verifica se a fila está vazia (pode mudar logo depois de lido)
+     * @return true se vazia, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool filaVazia() const { return getTamanho() == 0; }
+};
+
+#endif // FILA_BLOQUEANTE_H
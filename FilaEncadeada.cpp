@@ -34,23 +34,7 @@ Elemento *FilaEncadeada::desenfileirar()
  */
 Elemento *FilaEncadeada::consultarFrente() const
 {
-    if (filaVazia())
-    {
-        return nullptr;
-    }
-
-    // Para acessar o primeiro elemento, usamos o mesmo truque da pilha
-    // Removemos temporariamente e inserimos de volta
-    ListaDuplamenteEncadeada *listaTemp = const_cast<ListaDuplamenteEncadeada *>(&lista);
-
-    Elemento *frente = listaTemp->removerPrimeiro();
-
-    if (frente != nullptr)
-    {
-        listaTemp->inserirNoInicio(frente);
-    }
-
-    return frente;
+    return lista.primeiro();
 }
 
 /**
@@ -59,23 +43,7 @@ Elemento *FilaEncadeada::consultarFrente() const
  */
 Elemento *FilaEncadeada::consultarTras() const
 {
-    if (filaVazia())
-    {
-        return nullptr;
-    }
-
-    // Para acessar o último elemento, usamos o mesmo truque
-    // Removemos temporariamente e inserimos de volta
-    ListaDuplamenteEncadeada *listaTemp = const_cast<ListaDuplamenteEncadeada *>(&lista);
-
-    Elemento *tras = listaTemp->removerUltimo();
-
-    if (tras != nullptr)
-    {
-        listaTemp->inserirNoFim(tras);
-    }
-
-    return tras;
+    return lista.ultimo();
 }
 
 /**
@@ -0,0 +1,189 @@
+#include "FilaMPMC.h"
+#include <cstdint>
+#include <thread>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * Construtor da Fila MPMC
+ * Cada posição i começa na vez do produtor da primeira volta (sequência i)
+ * Complexidade: O(n) - Inicializa as sequências
+ */
+FilaMPMC::FilaMPMC(int capacidadeMinima) : capacidade(2), tras(0), frente(0)
+{
+    while (capacidade < capacidadeMinima && capacidade < CAPACIDADE_MAXIMA)
+    {
+        capacidade <<= 1;
+    }
+    mascara = static_cast<std::size_t>(capacidade) - 1;
+    celulas = std::make_unique<Celula[]>(capacidade);
+    for (int i = 0; i < capacidade; i++)
+    {
+        celulas[i].sequencia.store(static_cast<std::size_t>(i), std::memory_order_relaxed);
+        celulas[i].elemento = nullptr;
+    }
+}
+
+/**
+ * Destrutor da Fila MPMC
+ * Complexidade: O(n) - Precisa deletar todos os elementos
+ */
+FilaMPMC::~FilaMPMC()
+{
+    Elemento *elemento;
+    while ((elemento = desenfileirar()) != nullptr)
+    {
+        delete elemento;
+    }
+}
+
+/**
+ * Espera curta entre tentativas
+ * Complexidade: O(1)
+ */
+void FilaMPMC::aguardar(int &tentativas)
+{
+    if (++tentativas < GIROS_ANTES_DE_CEDER)
+    {
+#if defined(__SSE2__)
+        _mm_pause();
+#endif
+    }
+    else
+    {
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * Enfileira um elemento se houver espaço
+ * Com a sequência igual à posição, a célula está livre e os produtores
+ * disputam o contador; menor, o consumidor da volta anterior ainda não a
+ * liberou (fila cheia); maior, outro produtor já a tomou e a posição é relida
+ * Complexidade: O(1) sem disputa
+ */
+bool FilaMPMC::enfileirar(Elemento *elemento)
+{
+    if (elemento == nullptr)
+    {
+        return false;
+    }
+
+    std::size_t posicao = tras.load(std::memory_order_relaxed);
+    Celula *celula;
+    while (true)
+    {
+        celula = &celulas[posicao & mascara];
+        std::size_t sequencia = celula->sequencia.load(std::memory_order_acquire);
+        std::intptr_t diferenca = static_cast<std::intptr_t>(sequencia) - static_cast<std::intptr_t>(posicao);
+        if (diferenca == 0)
+        {
+            // Em caso de falha, compare_exchange_weak recarrega a posição atual
+            if (tras.compare_exchange_weak(posicao, posicao + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diferenca < 0)
+        {
+            return false;
+        }
+        else
+        {
+            posicao = tras.load(std::memory_order_relaxed);
+        }
+    }
+
+    celula->elemento = elemento;
+    celula->sequencia.store(posicao + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Desenfileira um elemento se houver
+ * A célula tem elemento quando a sequência é a posição + 1; ao esvaziá-la, a
+ * sequência passa à posição da volta seguinte (posição + capacidade)
+ * Complexidade: O(1) sem disputa
+ */
+Elemento *FilaMPMC::desenfileirar()
+{
+    std::size_t posicao = frente.load(std::memory_order_relaxed);
+    Celula *celula;
+    while (true)
+    {
+        celula = &celulas[posicao & mascara];
+        std::size_t sequencia = celula->sequencia.load(std::memory_order_acquire);
+        std::intptr_t diferenca = static_cast<std::intptr_t>(sequencia) - static_cast<std::intptr_t>(posicao + 1);
+        if (diferenca == 0)
+        {
+            if (frente.compare_exchange_weak(posicao, posicao + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diferenca < 0)
+        {
+            return nullptr;
+        }
+        else
+        {
+            posicao = frente.load(std::memory_order_relaxed);
+        }
+    }
+
+    Elemento *elemento = celula->elemento;
+    celula->sequencia.store(posicao + mascara + 1, std::memory_order_release);
+    return elemento;
+}
+
+/**
+ * Enfileira um elemento, esperando enquanto a fila estiver cheia
+ * Complexidade: O(1) sem espera
+ */
+bool FilaMPMC::enfileirarBloqueando(Elemento *elemento)
+{
+    if (elemento == nullptr)
+    {
+        return false;
+    }
+
+    int tentativas = 0;
+    while (!enfileirar(elemento))
+    {
+        aguardar(tentativas);
+    }
+    return true;
+}
+
+/**
+ * Desenfileira um elemento, esperando enquanto a fila estiver vazia
+ * Complexidade: O(1) sem espera
+ */
+Elemento *FilaMPMC::desenfileirarBloqueando()
+{
+    int tentativas = 0;
+    Elemento *elemento;
+    while ((elemento = desenfileirar()) == nullptr)
+    {
+        aguardar(tentativas);
+    }
+    return elemento;
+}
+
+/**
+ * Obtém o número de elementos na fila (estimativa com threads ativas)
+ * Complexidade: O(1)
+ */
+int FilaMPMC::getTamanho() const
+{
+    std::size_t inicio = frente.load(std::memory_order_acquire);
+    std::size_t fim = tras.load(std::memory_order_acquire);
+    if (fim <= inicio)
+    {
+        return 0;
+    }
+    std::size_t quantidade = fim - inicio;
+    return quantidade < static_cast<std::size_t>(capacidade) ? static_cast<int>(quantidade) : capacidade;
+}
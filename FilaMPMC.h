@@ -0,0 +1,131 @@
+#ifndef FILA_MPMC_H
+#define FILA_MPMC_H
+
+#include "Elemento.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * Classe Fila MPMC: fila circular limitada e sem travas para várias threads
+ * produtoras e consumidoras ao mesmo tempo (algoritmo de Dmitry Vyukov).
+ * Usa o array circular de capacidade potência de dois da FilaOtimizada, mas
+ * cada posição guarda, além do ponteiro, um número de sequência atômico que diz
+ * de quem é a vez na posição: igual ao contador de trás quando está livre para
+ * o produtor daquela volta, e igual a esse contador + 1 quando já tem um
+ * elemento para o consumidor. Produtores disputam o contador de trás e
+ * consumidores o de frente com compare-and-swap; quem ganha usa a posição
+ * sem concorrência e a libera publicando a nova sequência com ordem release.
+ * Os contadores ficam em linhas de cache separadas.
+ * enfileirar/desenfileirar têm a mesma semântica da FilaOtimizada (falham de
+ * imediato com a fila cheia ou vazia); as variantes "Bloqueando" esperam,
+ * girando e depois cedendo o processador.
+ * Demonstra o pilar do Encapsulamento ao esconder a sincronização.
+ */
+class FilaMPMC
+{
+private:
+    static const int CAPACIDADE_PADRAO = 1024;     // Capacidade alocada por padrão
+    static const int CAPACIDADE_MAXIMA = 1 << 30;  // Maior potência de dois representável
+    static const int TAMANHO_LINHA_CACHE = 64;     // Bytes por linha de cache
+    static const int GIROS_ANTES_DE_CEDER = 64;    // Tentativas seguidas antes de ceder o processador
+
+    /**
+     * Posição do array: o elemento e a sequência que controla a vez
+     */
+    struct Celula
+    {
+        std::atomic<std::size_t> sequencia; // Vez do produtor (== trás) ou do consumidor (== trás + 1)
+        Elemento *elemento;                 // Elemento guardado (válido na vez do consumidor)
+    };
+
+    // Somente leitura depois da construção
+    std::unique_ptr<Celula[]> celulas; // Array circular de posições
+    int capacidade;                    // Capacidade do array (potência de dois)
+    std::size_t mascara;               // capacidade - 1, para as posições no array
+
+    alignas(TAMANHO_LINHA_CACHE) std::atomic<std::size_t> tras;   // Próxima posição a preencher
+    alignas(TAMANHO_LINHA_CACHE) std::atomic<std::size_t> frente; // Próxima posição a esvaziar
+
+    /**
+     * Espera curta entre tentativas: gira nas primeiras e depois cede o processador
+     * @param tentativas Tentativas frustradas até agora (incrementado)
+     * Complexidade: O(1)
+     */
+    static void aguardar(int &tentativas);
+
+public:
+    /**
+     * Construtor da Fila MPMC
+     * @param capacidadeMinima Número máximo de elementos (arredondado para a
+     * próxima potência de dois, no mínimo 2)
+     */
+    explicit FilaMPMC(int capacidadeMinima = CAPACIDADE_PADRAO);
+
+    /**
+     * Destrutor da Fila MPMC (nenhuma thread pode estar usando a fila)
+     */
+    ~FilaMPMC();
+
+    FilaMPMC(const FilaMPMC &) = delete;
+    FilaMPMC &operator=(const FilaMPMC &) = delete;
+
+    /**
+     * Enfileira um elemento se houver espaço (qualquer thread)
+     * @param elemento Ponteiro para o elemento a ser enfileirado
+     * @return true se enfileirado com sucesso, false se a fila está cheia ou o
+     * elemento é nulo
+     * Complexidade: O(1) sem disputa; repete o compare-and-swap se outro
+     * produtor tomar a posição
+     */
+    bool enfileirar(Elemento *elemento);
+
+    /**
+     * Desenfileira um elemento se houver (qualquer thread)
+     * @return Ponteiro para o elemento desenfileirado ou nullptr se vazia
+     * Complexidade: O(1) sem disputa; repete o compare-and-swap se outro
+     * consumidor tomar a posição
+     */
+    Elemento *desenfileirar();
+
+    /**
+     * Enfileira um elemento, esperando enquanto a fila estiver cheia
+     * @param elemento Ponteiro para o elemento a ser enfileirado
+     * @return true se enfileirado, false se o elemento é nulo
+     * Complexidade: O(1) sem espera
+     */
+    bool enfileirarBloqueando(Elemento *elemento);
+
+    /**
+     * Desenfileira um elemento, esperando enquanto a fila estiver vazia
+     * Não há como interromper a espera: para encerrar consumidores, enfileire
+     * um elemento combinado como sinal de parada
+     * @return Ponteiro para o elemento desenfileirado
+     * Complexidade: O(1) sem espera
+     */
+    Elemento *desenfileirarBloqueando();
+
+    /**
+     * Obtém o número de elementos na fila. Com threads ativas, o valor é só
+     * uma estimativa: pode mudar logo depois de lido
+     * @return Número de elementos na fila
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * Verifica se a fila está vazia (estimativa, como getTamanho)
+     * @return true se vazia, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool filaVazia() const { return getTamanho() == 0; }
+
+    /**
+     * Obtém a capacidade da fila
+     * @return Número máximo de elementos
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const { return capacidade; }
+};
+
+#endif // FILA_MPMC_H
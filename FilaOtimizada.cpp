@@ -1,12 +1,20 @@
 #include "FilaOtimizada.h"
+#include <algorithm>
 #include <iostream>
+#include <new>
 
 /**
  * Construtor da Fila Otimizada
  * Complexidade: O(1)
  */
-FilaOtimizada::FilaOtimizada() : frente(0), tras(0), tamanho(0), capacidade(TAMANHO_MAX)
+FilaOtimizada::FilaOtimizada(int capacidadeInicial) : frente(0), tras(0), tamanho(0)
 {
+    capacidade = potenciaDeDoisAcima(std::max(capacidadeInicial, 1));
+    if (capacidade < 0)
+    {
+        capacidade = CAPACIDADE_MAXIMA;
+    }
+    mascara = capacidade - 1;
     elementos = std::make_unique<Elemento *[]>(capacidade);
 }
 
@@ -26,21 +34,76 @@ FilaOtimizada::~FilaOtimizada()
 }
 
 /**
- * Calcula o próximo índice na fila circular
+ * Calcula a menor potência de dois >= n
  * Complexidade: O(1)
  */
-int FilaOtimizada::proximoIndice(int indice) const
+int FilaOtimizada::potenciaDeDoisAcima(long long n)
 {
-    return (indice + 1) % capacidade;
+    if (n > CAPACIDADE_MAXIMA)
+    {
+        return -1;
+    }
+
+    int potencia = 1;
+    while (potencia < n)
+    {
+        potencia <<= 1;
+    }
+    return potencia;
+}
+
+/**
+ * Realoca o array, desenrolando o anel: a frente passa para a posição 0
+ * Complexidade: O(n) - Copia todos os ponteiros
+ */
+bool FilaOtimizada::realocar(int novaCapacidade)
+{
+    std::unique_ptr<Elemento *[]> novoArray(new (std::nothrow) Elemento *[novaCapacidade]);
+    if (!novoArray)
+    {
+        return false;
+    }
+
+    // Os elementos ocupam [frente, fim do array) e depois [0, tras)
+    int ateOFim = std::min(tamanho, capacidade - frente);
+    std::copy(elementos.get() + frente, elementos.get() + frente + ateOFim, novoArray.get());
+    std::copy(elementos.get(), elementos.get() + (tamanho - ateOFim), novoArray.get() + ateOFim);
+
+    elementos = std::move(novoArray);
+    capacidade = novaCapacidade;
+    mascara = capacidade - 1;
+    frente = 0;
+    tras = tamanho & mascara;
+    return true;
+}
+
+/**
+ * Reserva espaço para pelo menos n elementos
+ * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+ */
+bool FilaOtimizada::reservar(int n)
+{
+    if (n <= capacidade)
+    {
+        return true;
+    }
+
+    int novaCapacidade = potenciaDeDoisAcima(n);
+    return novaCapacidade > 0 && realocar(novaCapacidade);
 }
 
 /**
  * Enfileira um elemento (adiciona no final)
- * Complexidade: O(1) - Inserção direta no final da fila circular
+ * Com o array cheio, dobra a capacidade antes de inserir
+ * Complexidade: O(1) amortizado - Inserção direta no final da fila circular
  */
 bool FilaOtimizada::enfileirar(Elemento *elemento)
 {
-    if (filaCheia() || elemento == nullptr)
+    if (elemento == nullptr)
+    {
+        return false;
+    }
+    if (tamanho == capacidade && (filaCheia() || !realocar(capacidade * 2)))
     {
         return false;
     }
@@ -95,7 +158,7 @@ Elemento *FilaOtimizada::consultarTras() const
 
     // O índice de trás aponta para a próxima posição livre,
     // então o último elemento está na posição anterior
-    int indiceTras = (tras - 1 + capacidade) % capacidade;
+    int indiceTras = (tras - 1) & mascara;
     return elementos[indiceTras];
 }
 
@@ -105,7 +168,7 @@ Elemento *FilaOtimizada::consultarTras() const
  */
 bool FilaOtimizada::filaCheia() const
 {
-    return tamanho >= capacidade;
+    return tamanho >= CAPACIDADE_MAXIMA;
 }
 
 /**
@@ -143,7 +206,8 @@ void FilaOtimizada::imprimirFila() const
     std::cout << "Tamanho da fila: " << tamanho << std::endl;
     std::cout << "Índice da frente: " << frente << std::endl;
     std::cout << "Índice de trás: " << tras << std::endl;
+    std::cout << "Capacidade: " << capacidade << std::endl;
 
     std::cout << "\nNOTA: Esta implementação otimizada usa fila circular," << std::endl;
-    std::cout << "proporcionando operações O(1) tanto para enfileirar quanto para desenfileirar." << std::endl;
+    std::cout << "proporcionando operações O(1) tanto para enfileirar (amortizado) quanto para desenfileirar." << std::endl;
 }
@@ -7,18 +7,24 @@
 /**
  * Classe Fila Otimizada implementada com fila circular.
  * Esta implementação corrige o problema de eficiência da Fila básica.
+ * A capacidade é sempre uma potência de dois, de modo que avançar um índice
+ * circular é um E bit a bit com a máscara (capacidade - 1) em vez de um resto
+ * de divisão. Quando o array enche, ele dobra de tamanho e os elementos são
+ * copiados em ordem para o início do novo array (o anel é "desenrolado").
  * Demonstra o pilar do Encapsulamento ao esconder os detalhes de implementação.
  * Segue o padrão FIFO (First In, First Out) com operações O(1).
  */
 class FilaOtimizada
 {
 private:
-    static const int TAMANHO_MAX = 100;      // Capacidade máxima da fila
+    static const int CAPACIDADE_INICIAL = 16;      // Capacidade alocada na construção
+    static const int CAPACIDADE_MAXIMA = 1 << 30;  // Maior potência de dois representável
     std::unique_ptr<Elemento *[]> elementos; // Array circular de ponteiros para elementos
     int frente;                              // Índice do primeiro elemento
     int tras;                                // Índice da próxima posição livre
     int tamanho;                             // Número atual de elementos na fila
-    int capacidade;                          // Capacidade máxima da fila
+    int capacidade;                          // Capacidade atual do array (potência de dois)
+    int mascara;                             // capacidade - 1, para os índices circulares
 
     /**
      * Calcula o próximo índice na fila circular
@@ -26,13 +32,32 @@ private:
      * @return Próximo índice na fila circular
      * Complexidade: O(1)
      */
-    int proximoIndice(int indice) const;
+    int proximoIndice(int indice) const { return (indice + 1) & mascara; }
+
+    /**
+     * Calcula a menor potência de dois >= n
+     * @param n Número de posições necessárias
+     * @return Potência de dois, ou -1 se excede a capacidade máxima
+     * Complexidade: O(1)
+     */
+    static int potenciaDeDoisAcima(long long n);
+
+    /**
+     * Realoca o array para a capacidade informada, copiando os elementos em
+     * ordem a partir da posição 0
+     * @param novaCapacidade Nova capacidade (potência de dois >= tamanho)
+     * @return true se realocado com sucesso, false se faltou memória
+     * Complexidade: O(n) - Copia todos os ponteiros
+     */
+    bool realocar(int novaCapacidade);
 
 public:
     /**
      * Construtor da Fila Otimizada
+     * @param capacidadeInicial Número de posições alocadas inicialmente
+     * (arredondado para a próxima potência de dois)
      */
-    FilaOtimizada();
+    explicit FilaOtimizada(int capacidadeInicial = CAPACIDADE_INICIAL);
 
     /**
      * Destrutor da Fila Otimizada
@@ -42,8 +67,9 @@ public:
     /**
      * Enfileira um elemento (adiciona no final)
      * @param elemento Ponteiro para o elemento a ser enfileirado
-     * @return true se enfileirado com sucesso, false caso contrário
-     * Complexidade: O(1) - Inserção direta
+     * @return true se enfileirado com sucesso, false se o elemento é nulo ou
+     * faltou memória para crescer
+     * Complexidade: O(1) amortizado - Inserção direta; dobra o array quando cheio
      */
     bool enfileirar(Elemento *elemento);
 
@@ -70,11 +96,29 @@ public:
 
     /**
      * Verifica se a fila está cheia
+     * Como o array cresce sob demanda, só fica cheia ao atingir a capacidade máxima
      * @return true se cheia, false caso contrário
      * Complexidade: O(1)
      */
     bool filaCheia() const;
 
+    /**
+     * Reserva espaço para pelo menos n elementos, evitando realocações durante
+     * uma rajada de inserções
+     * @param n Capacidade mínima desejada (arredondada para a próxima potência de dois)
+     * @return true se a capacidade foi garantida, false se faltou memória ou
+     * n excede a capacidade máxima
+     * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+     */
+    bool reservar(int n);
+
+    /**
+     * Obtém a capacidade atualmente alocada
+     * @return Número de posições disponíveis sem realocação
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const { return capacidade; }
+
     /**
      * Verifica se a fila está vazia
      * @return true se vazia, false caso contrário
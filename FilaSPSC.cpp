@@ -0,0 +1,111 @@
+#include "FilaSPSC.h"
+
+/**
+ * Construtor da Fila SPSC
+ * Complexidade: O(1)
+ */
+FilaSPSC::FilaSPSC(int capacidadeMinima)
+    : capacidade(1), frente(0), trasEmCache(0), tras(0), frenteEmCache(0)
+{
+    while (capacidade < capacidadeMinima && capacidade < CAPACIDADE_MAXIMA)
+    {
+        capacidade <<= 1;
+    }
+    mascara = static_cast<std::size_t>(capacidade) - 1;
+    elementos = std::make_unique<Elemento *[]>(capacidade);
+}
+
+/**
+ * Destrutor da Fila SPSC
+ * Complexidade: O(n) - Precisa deletar todos os elementos
+ */
+FilaSPSC::~FilaSPSC()
+{
+    std::size_t fim = tras.load(std::memory_order_acquire);
+    for (std::size_t i = frente.load(std::memory_order_relaxed); i != fim; i++)
+    {
+        delete elementos[i & mascara];
+    }
+}
+
+/**
+ * Enfileira um elemento (somente a thread produtora)
+ * A frente só é relida quando a cópia em cache indica fila cheia
+ * Complexidade: O(1)
+ */
+bool FilaSPSC::enfileirar(Elemento *elemento)
+{
+    if (elemento == nullptr)
+    {
+        return false;
+    }
+
+    std::size_t posicao = tras.load(std::memory_order_relaxed);
+    if (posicao - frenteEmCache == static_cast<std::size_t>(capacidade))
+    {
+        frenteEmCache = frente.load(std::memory_order_acquire);
+        if (posicao - frenteEmCache == static_cast<std::size_t>(capacidade))
+        {
+            return false;
+        }
+    }
+
+    elementos[posicao & mascara] = elemento;
+    tras.store(posicao + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Desenfileira um elemento (somente a thread consumidora)
+ * A trás só é relida quando a cópia em cache indica fila vazia
+ * Complexidade: O(1)
+ */
+Elemento *FilaSPSC::desenfileirar()
+{
+    std::size_t posicao = frente.load(std::memory_order_relaxed);
+    if (posicao == trasEmCache)
+    {
+        trasEmCache = tras.load(std::memory_order_acquire);
+        if (posicao == trasEmCache)
+        {
+            return nullptr;
+        }
+    }
+
+    Elemento *elemento = elementos[posicao & mascara];
+    frente.store(posicao + 1, std::memory_order_release);
+    return elemento;
+}
+
+/**
+ * Consulta o elemento da frente sem removê-lo (somente a thread consumidora)
+ * Complexidade: O(1)
+ */
+Elemento *FilaSPSC::consultarFrente()
+{
+    std::size_t posicao = frente.load(std::memory_order_relaxed);
+    if (posicao == trasEmCache)
+    {
+        trasEmCache = tras.load(std::memory_order_acquire);
+        if (posicao == trasEmCache)
+        {
+            return nullptr;
+        }
+    }
+    return elementos[posicao & mascara];
+}
+
+/**
+ * Obtém o número de elementos na fila (estimativa com as threads ativas)
+ * A frente é lida antes da trás, para que a diferença nunca fique negativa;
+ * entre as duas leituras o consumidor pode avançar e o produtor preencher o
+ * espaço liberado, por isso o resultado é limitado à capacidade
+ * Complexidade: O(1)
+ */
+int FilaSPSC::getTamanho() const
+{
+    std::size_t inicio = frente.load(std::memory_order_acquire);
+    std::size_t fim = tras.load(std::memory_order_acquire);
+    std::size_t quantidade = fim - inicio;
+    return quantidade < static_cast<std::size_t>(capacidade) ? static_cast<int>(quantidade) : capacidade;
+}
@@ -0,0 +1,108 @@
+#ifndef FILA_SPSC_H
+#define FILA_SPSC_H
+
+#include "Elemento.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * Classe Fila SPSC: fila circular sem travas (lock-free) para exatamente uma
+ * thread produtora e uma thread consumidora.
+ * Usa o mesmo array circular de capacidade potência de dois da FilaOtimizada,
+ * mas frente e trás são contadores atômicos que só crescem (a posição no array
+ * é o contador E a máscara): só o consumidor escreve a frente e só o produtor
+ * escreve a trás. Cada lado publica o seu índice com ordem release e lê o do
+ * outro com acquire, o que garante que o ponteiro gravado no array é visível
+ * antes do índice que o publica.
+ * Cada lado guarda uma cópia do índice do outro e só relê o atômico quando a
+ * cópia indica fila cheia (produtor) ou vazia (consumidor), e os dois lados
+ * ficam em linhas de cache separadas para evitar falso compartilhamento.
+ * Ao contrário da FilaOtimizada, a capacidade é fixa: enfileirar em uma fila
+ * cheia devolve false e cabe ao produtor tentar de novo.
+ * Demonstra o pilar do Encapsulamento ao esconder a sincronização.
+ */
+class FilaSPSC
+{
+private:
+    static const int CAPACIDADE_PADRAO = 1024;     // Capacidade alocada por padrão
+    static const int CAPACIDADE_MAXIMA = 1 << 30;  // Maior potência de dois representável
+    static const int TAMANHO_LINHA_CACHE = 64;     // Bytes por linha de cache
+
+    // Somente leitura depois da construção (compartilhados sem custo)
+    std::unique_ptr<Elemento *[]> elementos; // Array circular de ponteiros para elementos
+    int capacidade;                          // Capacidade do array (potência de dois)
+    std::size_t mascara;                     // capacidade - 1, para as posições no array
+
+    // Lado do consumidor
+    alignas(TAMANHO_LINHA_CACHE) std::atomic<std::size_t> frente; // Elementos já desenfileirados
+    std::size_t trasEmCache;                                       // Última trás lida pelo consumidor
+
+    // Lado do produtor
+    alignas(TAMANHO_LINHA_CACHE) std::atomic<std::size_t> tras; // Elementos já enfileirados
+    std::size_t frenteEmCache;                                   // Última frente lida pelo produtor
+    // (o alinhamento da classe completa a linha do produtor até o fim do objeto)
+
+public:
+    /**
+     * Construtor da Fila SPSC
+     * @param capacidadeMinima Número máximo de elementos (arredondado para a
+     * próxima potência de dois)
+     */
+    explicit FilaSPSC(int capacidadeMinima = CAPACIDADE_PADRAO);
+
+    /**
+     * Destrutor da Fila SPSC (nenhuma das threads pode estar usando a fila)
+     */
+    ~FilaSPSC();
+
+    FilaSPSC(const FilaSPSC &) = delete;
+    FilaSPSC &operator=(const FilaSPSC &) = delete;
+
+    /**
+     * Enfileira um elemento (somente a thread produtora)
+     * @param elemento Ponteiro para o elemento a ser enfileirado
+     * @return true se enfileirado com sucesso, false se a fila está cheia ou o
+     * elemento é nulo
+     * Complexidade: O(1) - Sem travas nem alocação
+     */
+    bool enfileirar(Elemento *elemento);
+
+    /**
+     * Desenfileira um elemento (somente a thread consumidora)
+     * @return Ponteiro para o elemento desenfileirado ou nullptr se vazia
+     * Complexidade: O(1) - Sem travas nem alocação
+     */
+    Elemento *desenfileirar();
+
+    /**
+     * Consulta o elemento da frente sem removê-lo (somente a thread consumidora)
+     * @return Ponteiro para o elemento da frente ou nullptr se vazia
+     * Complexidade: O(1)
+     */
+    Elemento *consultarFrente();
+
+    /**
+     * Obtém o número de elementos na fila. Com as duas threads ativas, o valor
+     * é só uma estimativa: pode mudar logo depois de lido
+     * @return Número de elementos na fila
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * Verifica se a fila está vazia (estimativa, como getTamanho)
+     * @return true se vazia, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool filaVazia() const { return getTamanho() == 0; }
+
+    /**
+     * Obtém a capacidade da fila
+     * @return Número máximo de elementos
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const { return capacidade; }
+};
+
+#endif // FILA_SPSC_H
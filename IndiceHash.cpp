@@ -0,0 +1,198 @@
+#include "IndiceHash.h"
+#include <cstdint>
+
+/**
+ * Construtor do Índice Hash
+ * Complexidade: O(capacidade)
+ */
+IndiceHash::IndiceHash(int capacidadeInicial) : capacidade(0), bits(0), ocupadas(0), usadas(0)
+{
+    int novaCapacidade = 16;
+    while (novaCapacidade < capacidadeInicial)
+    {
+        novaCapacidade *= 2;
+    }
+    redimensionar(novaCapacidade);
+}
+
+/**
+ * Calcula a posição inicial de sondagem de uma chave
+ * Usa hash multiplicativo de Fibonacci: os bits mais altos do produto
+ * espalham bem IDs sequenciais, que são o caso comum
+ * Complexidade: O(1)
+ */
+int IndiceHash::espalhar(int chave) const
+{
+    uint32_t h = static_cast<uint32_t>(chave) * 2654435769u;
+    return static_cast<int>(h >> (32 - bits));
+}
+
+/**
+ * Localiza a posição da entrada (chave, valor)
+ * Complexidade: O(1) esperado
+ */
+int IndiceHash::localizar(int chave, int valor) const
+{
+    int mascara = capacidade - 1;
+    for (int i = espalhar(chave);; i = (i + 1) & mascara)
+    {
+        const Entrada &entrada = entradas[i];
+        if (entrada.estado == LIVRE)
+        {
+            return -1;
+        }
+        if (entrada.estado == OCUPADA && entrada.chave == chave && entrada.valor == valor)
+        {
+            return i;
+        }
+    }
+}
+
+/**
+ * Reconstrói a tabela com a nova capacidade, descartando as lápides
+ * Complexidade: O(capacidade)
+ */
+void IndiceHash::redimensionar(int novaCapacidade)
+{
+    std::unique_ptr<Entrada[]> antigas = std::move(entradas);
+    int capacidadeAntiga = capacidade;
+
+    entradas.reset(new Entrada[novaCapacidade]);
+    capacidade = novaCapacidade;
+    bits = 0;
+    while ((1 << bits) < capacidade)
+    {
+        bits++;
+    }
+    for (int i = 0; i < capacidade; i++)
+    {
+        entradas[i].estado = LIVRE;
+    }
+    ocupadas = 0;
+    usadas = 0;
+
+    for (int i = 0; i < capacidadeAntiga; i++)
+    {
+        if (antigas[i].estado == OCUPADA)
+        {
+            inserir(antigas[i].chave, antigas[i].valor);
+        }
+    }
+}
+
+/**
+ * Insere a associação (chave, valor)
+ * A tabela é mantida com no máximo 3/4 das posições usadas (incluindo lápides)
+ * Complexidade: O(1) esperado amortizado
+ */
+void IndiceHash::inserir(int chave, int valor)
+{
+    if ((usadas + 1) * 4 > capacidade * 3)
+    {
+        // Se a maior parte das posições usadas são lápides, basta limpar
+        redimensionar(ocupadas * 2 + 2 > capacidade ? capacidade * 2 : capacidade);
+    }
+
+    int mascara = capacidade - 1;
+    int i = espalhar(chave);
+    while (entradas[i].estado == OCUPADA)
+    {
+        i = (i + 1) & mascara;
+    }
+
+    if (entradas[i].estado == LIVRE)
+    {
+        usadas++;
+    }
+    entradas[i].chave = chave;
+    entradas[i].valor = valor;
+    entradas[i].estado = OCUPADA;
+    ocupadas++;
+}
+
+/**
+ * Remove a associação (chave, valor)
+ * Complexidade: O(1) esperado
+ */
+bool IndiceHash::remover(int chave, int valor)
+{
+    int posicao = localizar(chave, valor);
+    if (posicao == -1)
+    {
+        return false;
+    }
+
+    entradas[posicao].estado = REMOVIDA;
+    ocupadas--;
+    return true;
+}
+
+/**
+ * Substitui o valor de uma associação existente
+ * Complexidade: O(1) esperado
+ */
+bool IndiceHash::atualizar(int chave, int valorAntigo, int valorNovo)
+{
+    int posicao = localizar(chave, valorAntigo);
+    if (posicao == -1)
+    {
+        return false;
+    }
+
+    entradas[posicao].valor = valorNovo;
+    return true;
+}
+
+/**
+ * Busca o menor valor associado a uma chave
+ * Percorre toda a cadeia de sondagem, pois a chave pode se repetir
+ * Complexidade: O(1) esperado
+ */
+bool IndiceHash::buscarMenor(int chave, int &valor) const
+{
+    bool encontrado = false;
+    int mascara = capacidade - 1;
+
+    for (int i = espalhar(chave); entradas[i].estado != LIVRE; i = (i + 1) & mascara)
+    {
+        const Entrada &entrada = entradas[i];
+        if (entrada.estado == OCUPADA && entrada.chave == chave &&
+            (!encontrado || entrada.valor < valor))
+        {
+            valor = entrada.valor;
+            encontrado = true;
+        }
+    }
+    return encontrado;
+}
+
+/**
+ * Remove todas as associações, mantendo a capacidade
+ * Complexidade: O(capacidade)
+ */
+void IndiceHash::limpar()
+{
+    for (int i = 0; i < capacidade; i++)
+    {
+        entradas[i].estado = LIVRE;
+    }
+    ocupadas = 0;
+    usadas = 0;
+}
+
+/**
+ * Reserva espaço para n associações sem redimensionar
+ * Complexidade: O(capacidade) se precisar redimensionar
+ */
+void IndiceHash::reservar(int n)
+{
+    int novaCapacidade = capacidade;
+    while (static_cast<long long>(n) * 4 > static_cast<long long>(novaCapacidade) * 3)
+    {
+        novaCapacidade *= 2;
+    }
+    if (novaCapacidade != capacidade)
+    {
+        redimensionar(novaCapacidade);
+    }
+}
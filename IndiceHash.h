@@ -0,0 +1,118 @@
+#ifndef INDICE_HASH_H
+#define INDICE_HASH_H
+
+#include <memory>
+
+/**
+ * Classe que implementa um índice hash de endereçamento aberto (sondagem linear)
+ * associando IDs a valores inteiros (por exemplo, posições em um array).
+ * Uma mesma chave pode ter vários valores, o que permite indexar listas com IDs repetidos.
+ * Demonstra o pilar do Encapsulamento ao esconder a tabela e a função de espalhamento.
+ */
+class IndiceHash
+{
+private:
+    /**
+     * Estados possíveis de uma posição da tabela
+     */
+    enum Estado : unsigned char
+    {
+        LIVRE,
+        OCUPADA,
+        REMOVIDA // Marca de remoção (lápide), mantém a cadeia de sondagem
+    };
+
+    /**
+     * Estrutura privada que representa uma entrada da tabela
+     */
+    struct Entrada
+    {
+        int chave;
+        int valor;
+        Estado estado;
+    };
+
+    std::unique_ptr<Entrada[]> entradas; // Tabela de entradas
+    int capacidade;                      // Número de posições da tabela (potência de 2)
+    int bits;                            // log2(capacidade), usado no espalhamento
+    int ocupadas;                        // Entradas válidas
+    int usadas;                          // Entradas válidas + lápides
+
+    /**
+     * Calcula a posição inicial de sondagem de uma chave (hash multiplicativo)
+     * @param chave Chave a ser espalhada
+     * @return Posição na tabela
+     * Complexidade: O(1)
+     */
+    int espalhar(int chave) const;
+
+    /**
+     * Localiza a posição da entrada (chave, valor)
+     * @return Posição na tabela ou -1 se não encontrada
+     * Complexidade: O(1) esperado
+     */
+    int localizar(int chave, int valor) const;
+
+    /**
+     * Reconstrói a tabela com a nova capacidade, descartando as lápides
+     * @param novaCapacidade Nova capacidade (potência de 2)
+     * Complexidade: O(capacidade)
+     */
+    void redimensionar(int novaCapacidade);
+
+public:
+    /**
+     * Construtor do Índice Hash
+     * @param capacidadeInicial Número mínimo de posições da tabela
+     */
+    explicit IndiceHash(int capacidadeInicial = 16);
+
+    /**
+     * Insere a associação (chave, valor)
+     * Complexidade: O(1) esperado amortizado
+     */
+    void inserir(int chave, int valor);
+
+    /**
+     * Remove a associação (chave, valor)
+     * @return true se removida, false se não existia
+     * Complexidade: O(1) esperado
+     */
+    bool remover(int chave, int valor);
+
+    /**
+     * Substitui o valor de uma associação existente
+     * @return true se atualizada, false se (chave, valorAntigo) não existia
+     * Complexidade: O(1) esperado
+     */
+    bool atualizar(int chave, int valorAntigo, int valorNovo);
+
+    /**
+     * Busca o menor valor associado a uma chave
+     * @param chave Chave procurada
+     * @param valor Recebe o menor valor associado, se houver
+     * @return true se a chave existe, false caso contrário
+     * Complexidade: O(1) esperado (proporcional às repetições da chave)
+     */
+    bool buscarMenor(int chave, int &valor) const;
+
+    /**
+     * Remove todas as associações, mantendo a capacidade
+     * Complexidade: O(capacidade)
+     */
+    void limpar();
+
+    /**
+     * Reserva espaço para n associações sem redimensionar
+     * Complexidade: O(capacidade) se precisar redimensionar
+     */
+    void reservar(int n);
+
+    /**
+     * Obtém o número de associações armazenadas
+     * Complexidade: O(1)
+     */
+    int getTamanho() const { return ocupadas; }
+};
+
+#endif // INDICE_HASH_H
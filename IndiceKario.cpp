@@ -0,0 +1,152 @@
+#include "IndiceKario.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * Construtor de um índice vazio
+ * Complexidade: O(1)
+ */
+IndiceKario::IndiceKario()
+    : folhas(nullptr), internos(nullptr), numeroNiveis(0), numeroFolhas(0), tamanho(0)
+{
+}
+
+/**
+ * Conta as chaves de um nó menores que a chave procurada
+ * Como as chaves do nó estão em ordem, a contagem é a posição do limite inferior
+ * Complexidade: O(1)
+ */
+int IndiceKario::contarMenores(const int *no, int chave)
+{
+#if defined(__AVX2__)
+    const __m256i alvo = _mm256_set1_epi32(chave);
+    __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i *>(no));
+    __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i *>(no + 8));
+    unsigned mascaraA = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(alvo, a))));
+    unsigned mascaraB = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(alvo, b))));
+    return __builtin_popcount(mascaraA | (mascaraB << 8));
+#elif defined(__SSE2__)
+    const __m128i alvo = _mm_set1_epi32(chave);
+    unsigned mascara = 0;
+    for (int i = 0; i < CHAVES_POR_NO; i += 4)
+    {
+        __m128i bloco = _mm_load_si128(reinterpret_cast<const __m128i *>(no + i));
+        mascara |= static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(alvo, bloco)))) << i;
+    }
+    return __builtin_popcount(mascara);
+#else
+    int menores = 0;
+    for (int i = 0; i < CHAVES_POR_NO; i++)
+    {
+        menores += no[i] < chave;
+    }
+    return menores;
+#endif
+}
+
+/**
+ * Reconstrói o índice sobre um array ordenado de chaves
+ * Os níveis internos são dimensionados de baixo para cima (cada um com
+ * ⌈filhos / 17⌉ nós) e guardados de cima para baixo, todos alinhados a 64
+ * bytes. O separador j de um nó é a primeira chave da folha mais à esquerda
+ * do filho j + 1, ou o maior int se esse filho não existe
+ * Complexidade: O(n)
+ */
+bool IndiceKario::construir(const int *chaves, int n)
+{
+    blocoMemoria.reset();
+    folhas = internos = nullptr;
+    numeroNiveis = numeroFolhas = tamanho = 0;
+    if (n <= 0)
+    {
+        return true;
+    }
+
+    int folhasNecessarias = (n + CHAVES_POR_NO - 1) / CHAVES_POR_NO;
+    int nosPorNivel[MAXIMO_NIVEIS];
+    int niveis = 0;
+    int totalInternos = 0;
+    for (int filhos = folhasNecessarias; filhos > 1; filhos = nosPorNivel[niveis++])
+    {
+        nosPorNivel[niveis] = (filhos + FILHOS_POR_NO - 1) / FILHOS_POR_NO;
+        totalInternos += nosPorNivel[niveis];
+    }
+
+    std::size_t posicoes = (static_cast<std::size_t>(folhasNecessarias) + totalInternos) * CHAVES_POR_NO;
+    blocoMemoria.reset(new (std::nothrow) int[posicoes + CHAVES_POR_NO]);
+    if (!blocoMemoria)
+    {
+        return false;
+    }
+    std::uintptr_t endereco = reinterpret_cast<std::uintptr_t>(blocoMemoria.get());
+    std::uintptr_t alinhado = (endereco + 63) & ~static_cast<std::uintptr_t>(63);
+    internos = blocoMemoria.get() + (alinhado - endereco) / sizeof(int);
+    folhas = internos + static_cast<std::size_t>(totalInternos) * CHAVES_POR_NO;
+
+    tamanho = n;
+    numeroFolhas = folhasNecessarias;
+    numeroNiveis = niveis;
+    std::copy(chaves, chaves + n, folhas);
+    std::fill(folhas + n, folhas + static_cast<std::size_t>(numeroFolhas) * CHAVES_POR_NO,
+              std::numeric_limits<int>::max());
+
+    // nosPorNivel foi preenchido de baixo para cima; o nível 0 é a raiz
+    int inicio = 0;
+    for (int nivel = 0; nivel < numeroNiveis; nivel++)
+    {
+        inicioNivel[nivel] = inicio;
+        inicio += nosPorNivel[numeroNiveis - 1 - nivel];
+    }
+
+    // Folhas sob cada filho de um nó do nível: 17^(níveis abaixo do filho)
+    long long folhasPorFilho = 1;
+    for (int nivel = numeroNiveis - 1; nivel >= 0; nivel--)
+    {
+        int nos = nosPorNivel[numeroNiveis - 1 - nivel];
+        for (int no = 0; no < nos; no++)
+        {
+            int *separadores = internos + static_cast<std::size_t>(inicioNivel[nivel] + no) * CHAVES_POR_NO;
+            for (int j = 0; j < CHAVES_POR_NO; j++)
+            {
+                long long filho = static_cast<long long>(no) * FILHOS_POR_NO + j + 1;
+                long long folha = filho * folhasPorFilho;
+                separadores[j] = folha < numeroFolhas ? folhas[folha * CHAVES_POR_NO] : std::numeric_limits<int>::max();
+            }
+        }
+        folhasPorFilho *= FILHOS_POR_NO;
+    }
+    return true;
+}
+
+/**
+ * Encontra a posição da primeira chave >= chave
+ * Em cada nível, o número de separadores menores que a chave é o filho a
+ * seguir: a resposta está nele ou logo depois do seu fim, que é o início do
+ * próximo bloco de folhas e, portanto, a mesma posição global
+ * Complexidade: O(log17 n)
+ */
+int IndiceKario::limiteInferior(int chave) const
+{
+    if (tamanho == 0)
+    {
+        return 0;
+    }
+
+    int no = 0;
+    for (int nivel = 0; nivel < numeroNiveis; nivel++)
+    {
+        const int *separadores = internos + static_cast<std::size_t>(inicioNivel[nivel] + no) * CHAVES_POR_NO;
+        no = no * FILHOS_POR_NO + contarMenores(separadores, chave);
+    }
+
+    long long posicao = static_cast<long long>(no) * CHAVES_POR_NO +
+                        contarMenores(folhas + static_cast<std::size_t>(no) * CHAVES_POR_NO, chave);
+    return static_cast<int>(std::min(posicao, static_cast<long long>(tamanho)));
+}
@@ -0,0 +1,81 @@
+#ifndef INDICE_KARIO_H
+#define INDICE_KARIO_H
+
+#include <memory>
+
+/**
+ * Classe que implementa um índice estático em árvore k-ária sobre um array
+ * ordenado de chaves (IDs), no estilo da FAST (Fast Architecture Sensitive Tree).
+ * Cada nó ocupa exatamente uma linha de cache de 64 bytes com 16 chaves, e as
+ * 16 são comparadas com a chave procurada de uma vez (AVX2 ou SSE2): o número
+ * de chaves menores (contagem de bits da máscara) já é o filho a seguir.
+ * Assim a busca toca uma linha de cache por nível, com log17(n) níveis, em vez
+ * de uma por passo da busca binária.
+ * As folhas são uma cópia das chaves em blocos de 16; cada nó interno guarda,
+ * para os filhos 1..16, a primeira chave da subárvore do filho.
+ * Demonstra o pilar do Encapsulamento ao esconder o layout dos nós.
+ */
+class IndiceKario
+{
+private:
+    static const int CHAVES_POR_NO = 16;  // Chaves por nó (uma linha de cache)
+    static const int FILHOS_POR_NO = 17;  // Filhos de um nó interno
+    static const int MAXIMO_NIVEIS = 8;   // Níveis internos suficientes para 2^31 chaves
+
+    std::unique_ptr<int[]> blocoMemoria;   // Memória dos nós (com folga para o alinhamento)
+    int *folhas;                           // Chaves em blocos de 16 (completadas com o maior int)
+    int *internos;                         // Nós internos, nível a nível a partir da raiz
+    int inicioNivel[MAXIMO_NIVEIS];        // Primeiro nó de cada nível interno em internos
+    int numeroNiveis;                      // Número de níveis internos
+    int numeroFolhas;                      // Número de blocos de folhas
+    int tamanho;                           // Número de chaves indexadas
+
+    /**
+     * Conta as chaves de um nó menores que a chave procurada
+     * @param no Primeira das 16 chaves do nó (alinhada a 64 bytes)
+     * @param chave Chave procurada
+     * @return Número de chaves menores (0 a 16)
+     * Complexidade: O(1) - Duas comparações de 8 chaves com AVX2
+     */
+    static int contarMenores(const int *no, int chave);
+
+public:
+    /**
+     * Construtor de um índice vazio
+     */
+    IndiceKario();
+
+    IndiceKario(const IndiceKario &) = delete;
+    IndiceKario &operator=(const IndiceKario &) = delete;
+
+    /**
+     * Reconstrói o índice sobre um array ordenado de chaves
+     * @param chaves Array ordenado
+     * @param n Número de chaves
+     * @return true se construído, false (índice vazio) se faltou memória
+     * Complexidade: O(n)
+     */
+    bool construir(const int *chaves, int n);
+
+    /**
+     * Encontra a posição, no array indexado, da primeira chave >= chave
+     * @param chave Chave procurada
+     * @return Posição encontrada (n se todas forem menores)
+     * Complexidade: O(log17 n) - Um nó (uma linha de cache) por nível
+     */
+    int limiteInferior(int chave) const;
+
+    /**
+     * Obtém o número de chaves indexadas
+     * Complexidade: O(1)
+     */
+    int getTamanho() const { return tamanho; }
+
+    /**
+     * Obtém o número de níveis da árvore, contando as folhas
+     * Complexidade: O(1)
+     */
+    int getNiveis() const { return tamanho > 0 ? numeroNiveis + 1 : 0; }
+};
+
+#endif // INDICE_KARIO_H
@@ -130,6 +130,58 @@ Elemento *ListaDuplamenteEncadeada::removerPeloId(int id)
     return elementoRemovido;
 }
 
+/**
+ * Remove todos os elementos que satisfazem o predicado
+ * Cada nó removido é desligado dos vizinhos em O(1) durante o próprio percurso
+ * Complexidade: O(n)
+ */
+int ListaDuplamenteEncadeada::removerSe(const std::function<bool(const Elemento *)> &predicado,
+                                        std::vector<Elemento *> *removidos)
+{
+    int quantidadeRemovida = 0;
+    No *atual = cabeca;
+
+    while (atual != nullptr)
+    {
+        No *proximo = atual->proximo;
+        if (predicado(atual->elemento))
+        {
+            if (atual->anterior != nullptr)
+            {
+                atual->anterior->proximo = proximo;
+            }
+            else
+            {
+                cabeca = proximo;
+            }
+
+            if (proximo != nullptr)
+            {
+                proximo->anterior = atual->anterior;
+            }
+            else
+            {
+                cauda = atual->anterior;
+            }
+
+            if (removidos != nullptr)
+            {
+                removidos->push_back(atual->elemento);
+            }
+            else
+            {
+                delete atual->elemento;
+            }
+            delete atual;
+            quantidadeRemovida++;
+        }
+        atual = proximo;
+    }
+
+    tamanho -= quantidadeRemovida;
+    return quantidadeRemovida;
+}
+
 /**
  * Busca um elemento pelo ID
  * Complexidade: O(n) - Busca linear
@@ -271,3 +323,15 @@ void ListaDuplamenteEncadeada::imprimirTodosReverso() const
     }
     std::cout << "Total de elementos: " << tamanho << std::endl;
 }
+
+/**
+ * Visita todos os elementos do início ao fim
+ * Complexidade: O(n)
+ */
+void ListaDuplamenteEncadeada::paraCada(const std::function<void(const Elemento *)> &visitante) const
+{
+    for (No *atual = cabeca; atual != nullptr; atual = atual->proximo)
+    {
+        visitante(atual->elemento);
+    }
+}
@@ -2,6 +2,10 @@
 #define LISTA_DUPLAMENTE_ENCADEADA_H
 
 #include "Elemento.h"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
 
 /**
  * Classe que implementa uma Lista Duplamente Encadeada com alocação dinâmica.
@@ -44,6 +48,44 @@ private:
     No *encontrarNo(int id) const;
 
 public:
+    /**
+     * Iterador constante compatível com a STL (forward iterator), que percorre
+     * os elementos do início ao fim seguindo os ponteiros dos nós
+     * Complexidade: O(1) por avanço
+     */
+    class Iterador
+    {
+    private:
+        const No *atual; // Nó atual (nullptr no fim)
+
+        explicit Iterador(const No *no) : atual(no) {}
+        friend class ListaDuplamenteEncadeada;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Elemento *value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Elemento *const *pointer;
+        typedef Elemento *const &reference;
+
+        Iterador() : atual(nullptr) {}
+        reference operator*() const { return atual->elemento; }
+        pointer operator->() const { return &atual->elemento; }
+        Iterador &operator++()
+        {
+            atual = atual->proximo;
+            return *this;
+        }
+        Iterador operator++(int)
+        {
+            Iterador anterior = *this;
+            atual = atual->proximo;
+            return anterior;
+        }
+        bool operator==(const Iterador &outro) const { return atual == outro.atual; }
+        bool operator!=(const Iterador &outro) const { return atual != outro.atual; }
+    };
+
     /**
      * Construtor da Lista Duplamente Encadeada
      */
@@ -78,6 +120,17 @@ public:
      */
     Elemento *removerPeloId(int id);
 
+    /**
+     * Remove, em uma única passada, todos os elementos que satisfazem o predicado
+     * @param predicado Função que recebe um elemento e retorna true se ele deve sair
+     * @param removidos Se informado, recebe os elementos removidos (na ordem da lista)
+     * e o chamador passa a ser dono deles; se nullptr, os elementos são liberados
+     * @return Número de elementos removidos
+     * Complexidade: O(n) - Religa os nós em um único percurso
+     */
+    int removerSe(const std::function<bool(const Elemento *)> &predicado,
+                  std::vector<Elemento *> *removidos = nullptr);
+
     /**
      * Busca um elemento pelo ID
      * @param id ID do elemento a ser buscado
@@ -109,6 +162,20 @@ public:
      */
     int getTamanho() const { return tamanho; }
 
+    /**
+     * Obtém o primeiro elemento da lista, sem removê-lo
+     * @return Ponteiro para o elemento ou nullptr se vazia
+     * Complexidade: O(1) - Acesso direto à cabeça
+     */
+    Elemento *primeiro() const { return cabeca != nullptr ? cabeca->elemento : nullptr; }
+
+    /**
+     * Obtém o último elemento da lista, sem removê-lo
+     * @return Ponteiro para o elemento ou nullptr se vazia
+     * Complexidade: O(1) - Acesso direto à cauda
+     */
+    Elemento *ultimo() const { return cauda != nullptr ? cauda->elemento : nullptr; }
+
     /**
      * Remove o primeiro elemento da lista
      * @return Ponteiro para o elemento removido ou nullptr se vazia
@@ -134,6 +201,25 @@ public:
      * Complexidade: O(n)
      */
     void imprimirTodosReverso() const;
+
+    /**
+     * Visita todos os elementos do início ao fim, sem cópias nem impressão
+     * @param visitante Função chamada uma vez para cada elemento
+     * Complexidade: O(n)
+     */
+    void paraCada(const std::function<void(const Elemento *)> &visitante) const;
+
+    /**
+     * Iterador para o primeiro elemento
+     * Complexidade: O(1)
+     */
+    Iterador begin() const { return Iterador(cabeca); }
+
+    /**
+     * Iterador para depois do último elemento
+     * Complexidade: O(1)
+     */
+    Iterador end() const { return Iterador(); }
 };
 
 #endif // LISTA_DUPLAMENTE_ENCADEADA_H
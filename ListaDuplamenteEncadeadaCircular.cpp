@@ -108,6 +108,44 @@ Elemento *ListaDuplamenteEncadeadaCircular::removerPeloId(int id)
     return elementoRemovido;
 }
 
+/**
+ * Remove todos os elementos que satisfazem o predicado
+ * O sentinela dispensa os casos especiais de início e fim: cada nó removido
+ * é desligado dos vizinhos em O(1) durante o próprio percurso
+ * Complexidade: O(n)
+ */
+int ListaDuplamenteEncadeadaCircular::removerSe(const std::function<bool(const Elemento *)> &predicado,
+                                                std::vector<Elemento *> *removidos)
+{
+    int quantidadeRemovida = 0;
+    No *atual = sentinela->proximo;
+
+    while (atual != sentinela)
+    {
+        No *proximo = atual->proximo;
+        if (predicado(atual->elemento))
+        {
+            atual->anterior->proximo = proximo;
+            proximo->anterior = atual->anterior;
+
+            if (removidos != nullptr)
+            {
+                removidos->push_back(atual->elemento);
+            }
+            else
+            {
+                delete atual->elemento;
+            }
+            delete atual;
+            quantidadeRemovida++;
+        }
+        atual = proximo;
+    }
+
+    tamanho -= quantidadeRemovida;
+    return quantidadeRemovida;
+}
+
 /**
  * Busca um elemento pelo ID
  * Complexidade: O(n) - Busca linear
@@ -208,6 +246,12 @@ void ListaDuplamenteEncadeadaCircular::imprimirTodos(int numVoltas) const
         atual = atual->proximo;
         elementosImpressos++;
 
+        // O sentinela não contém elemento: a volta continua no nó seguinte
+        if (atual == sentinela)
+        {
+            atual = sentinela->proximo;
+        }
+
         if (atual == sentinela->proximo)
         {
             voltasCompletas++;
@@ -246,6 +290,12 @@ void ListaDuplamenteEncadeadaCircular::imprimirTodosReverso(int numVoltas) const
         atual = atual->anterior;
         elementosImpressos++;
 
+        // O sentinela não contém elemento: a volta continua no nó anterior
+        if (atual == sentinela)
+        {
+            atual = sentinela->anterior;
+        }
+
         if (atual == sentinela->anterior)
         {
             voltasCompletas++;
@@ -259,3 +309,15 @@ void ListaDuplamenteEncadeadaCircular::imprimirTodosReverso(int numVoltas) const
     std::cout << "Total de elementos: " << tamanho << std::endl;
     std::cout << "Elementos impressos: " << elementosImpressos << std::endl;
 }
+
+/**
+ * Visita todos os elementos do início ao fim, em uma única volta
+ * Complexidade: O(n)
+ */
+void ListaDuplamenteEncadeadaCircular::paraCada(const std::function<void(const Elemento *)> &visitante) const
+{
+    for (No *atual = sentinela->proximo; atual != sentinela; atual = atual->proximo)
+    {
+        visitante(atual->elemento);
+    }
+}
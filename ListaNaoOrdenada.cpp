@@ -1,13 +1,27 @@
 #include "ListaNaoOrdenada.h"
+#include "OperacoesVetoriais.h"
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <new>
+
+const int ListaNaoOrdenada::CAPACIDADE_MAXIMA = std::numeric_limits<int>::max();
 
 /**
  * Construtor da Lista Não Ordenada
  * Complexidade: O(1)
  */
-ListaNaoOrdenada::ListaNaoOrdenada() : tamanho(0), capacidade(TAMANHO_MAX)
+ListaNaoOrdenada::ListaNaoOrdenada(int capacidadeInicial, double fatorCrescimento,
+                                   PoliticaRemocao politicaRemocao)
+    : inicio(0),
+      tamanho(0),
+      capacidade(capacidadeInicial > 0 ? capacidadeInicial : 1),
+      origem(0),
+      fatorCrescimento(fatorCrescimento > 1.0 ? fatorCrescimento : 2.0),
+      politicaRemocao(politicaRemocao)
 {
     elementos = new Elemento *[capacidade];
+    ids = new int[capacidade];
 }
 
 /**
@@ -18,70 +32,390 @@ ListaNaoOrdenada::~ListaNaoOrdenada()
 {
     for (int i = 0; i < tamanho; i++)
     {
-        delete elementos[i];
+        delete elementos[fisica(i)];
+    }
+    delete[] elementos;
+    delete[] ids;
+}
+
+/**
+ * Realoca os arrays para a capacidade informada, copiando os elementos e IDs
+ * Usa new (std::nothrow) para que a falta de memória seja reportada como
+ * retorno false, seguindo o padrão das operações de inserção.
+ * Os elementos são copiados em ordem, de modo que o início volta ao índice 0;
+ * as posições na lista não mudam, então o índice hash continua válido
+ * Complexidade: O(n) - Copia todos os ponteiros e IDs
+ */
+bool ListaNaoOrdenada::realocar(int novaCapacidade)
+{
+    Elemento **novoArray = new (std::nothrow) Elemento *[novaCapacidade];
+    int *novosIds = new (std::nothrow) int[novaCapacidade];
+    if (novoArray == nullptr || novosIds == nullptr)
+    {
+        delete[] novoArray;
+        delete[] novosIds;
+        return false;
+    }
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        int origemFisica = fisica(i);
+        novoArray[i] = elementos[origemFisica];
+        novosIds[i] = ids[origemFisica];
     }
+
     delete[] elementos;
+    delete[] ids;
+    elementos = novoArray;
+    ids = novosIds;
+    capacidade = novaCapacidade;
+    inicio = 0;
+    return true;
+}
+
+/**
+ * Calcula a capacidade a alocar para comportar pelo menos "minimo" elementos
+ * A capacidade é multiplicada por fatorCrescimento, o que dá custo O(1) amortizado
+ * Complexidade: O(1)
+ */
+int ListaNaoOrdenada::calcularCrescimento(long long minimo) const
+{
+    if (minimo > CAPACIDADE_MAXIMA)
+    {
+        return -1;
+    }
+
+    double desejada = capacidade * fatorCrescimento;
+    if (desejada < minimo)
+    {
+        desejada = static_cast<double>(minimo);
+    }
+    return desejada >= CAPACIDADE_MAXIMA ? CAPACIDADE_MAXIMA : static_cast<int>(desejada);
+}
+
+/**
+ * Garante espaço para pelo menos "quantidade" elementos além dos atuais
+ * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+ */
+bool ListaNaoOrdenada::garantirEspacoPara(size_t quantidade)
+{
+    if (quantidade <= static_cast<size_t>(capacidade - tamanho))
+    {
+        return true;
+    }
+
+    if (quantidade > static_cast<size_t>(CAPACIDADE_MAXIMA))
+    {
+        return false;
+    }
+    long long minimo = static_cast<long long>(tamanho) + static_cast<long long>(quantidade);
+    int novaCapacidade = calcularCrescimento(minimo);
+    return novaCapacidade != -1 && realocar(novaCapacidade);
+}
+
+/**
+ * Garante espaço para pelo menos mais um elemento
+ * Complexidade: O(1) amortizado
+ */
+bool ListaNaoOrdenada::garantirEspaco()
+{
+    return garantirEspacoPara(1);
+}
+
+/**
+ * Reconstrói o índice hash com origem 0 quando a origem se aproxima dos limites de int
+ * A origem só muda em operações no início da lista, e a margem de 2^30 garante
+ * que origem + posição nunca transborde
+ * Complexidade: O(1) normalmente, O(n) quando precisa reconstruir
+ */
+void ListaNaoOrdenada::normalizarOrigem()
+{
+    const int LIMITE = 1 << 30;
+    if (origem > -LIMITE && origem < LIMITE)
+    {
+        return;
+    }
+
+    origem = 0;
+    if (indice)
+    {
+        indice->limpar();
+        for (int i = 0; i < tamanho; i++)
+        {
+            indice->inserir(ids[fisica(i)], i);
+        }
+    }
+}
+
+/**
+ * Reserva espaço para pelo menos n elementos
+ * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+ */
+bool ListaNaoOrdenada::reservar(int n)
+{
+    if (n <= capacidade)
+    {
+        return true;
+    }
+    return realocar(n);
+}
+
+/**
+ * Reduz a capacidade do array ao número atual de elementos
+ * Complexidade: O(n) - Realoca e copia os ponteiros
+ */
+void ListaNaoOrdenada::encolher()
+{
+    int novaCapacidade = tamanho > 0 ? tamanho : 1;
+    if (novaCapacidade < capacidade)
+    {
+        // Em caso de falta de memória, mantém o array atual
+        realocar(novaCapacidade);
+    }
+}
+
+/**
+ * Encontra a posição do primeiro elemento com o ID informado
+ * Sem índice, percorre o array contíguo de IDs com instruções SIMD,
+ * sem acessar os objetos apontados. Como o array é circular, a lista
+ * ocupa no máximo dois trechos contíguos, percorridos em ordem
+ * Complexidade: O(1) esperado com índice, O(n) sem índice
+ */
+int ListaNaoOrdenada::encontrarPosicao(int id) const
+{
+    if (indice)
+    {
+        int valor;
+        return indice->buscarMenor(id, valor) ? valor - origem : -1;
+    }
+
+    int primeiroTrecho = capacidade - inicio < tamanho ? capacidade - inicio : tamanho;
+    int posicao = OperacoesVetoriais::buscarChave(ids + inicio, primeiroTrecho, id);
+    if (posicao != -1 || primeiroTrecho == tamanho)
+    {
+        return posicao;
+    }
+
+    posicao = OperacoesVetoriais::buscarChave(ids, tamanho - primeiroTrecho, id);
+    return posicao != -1 ? primeiroTrecho + posicao : -1;
+}
+
+/**
+ * Remove o elemento da posição informada, fechando o buraco conforme a política
+ * Complexidade: O(min(posicao, n - posicao)) ao preservar a ordem, O(1) ao trocar
+ */
+Elemento *ListaNaoOrdenada::removerNaPosicao(int posicao)
+{
+    int indiceFisico = fisica(posicao);
+    Elemento *elementoRemovido = elementos[indiceFisico];
+    if (indice)
+    {
+        indice->remover(ids[indiceFisico], origem + posicao);
+    }
+
+    int ultima = tamanho - 1;
+
+    if (politicaRemocao == TROCAR_COM_ULTIMO && posicao != 0)
+    {
+        // Move o último elemento para o buraco, sem deslocar os demais
+        if (posicao != ultima)
+        {
+            int fisicaUltima = fisica(ultima);
+            elementos[indiceFisico] = elementos[fisicaUltima];
+            ids[indiceFisico] = ids[fisicaUltima];
+            if (indice)
+            {
+                indice->atualizar(ids[indiceFisico], origem + ultima, origem + posicao);
+            }
+        }
+    }
+    else if (posicao < ultima - posicao)
+    {
+        // Mais perto do início: desloca os anteriores uma posição para a direita
+        // e avança o início; as posições dos deslocados não mudam, mas a origem
+        // avança, então seus valores no índice aumentam em 1
+        for (int i = posicao; i > 0; i--)
+        {
+            int destino = fisica(i);
+            int fonte = fisica(i - 1);
+            elementos[destino] = elementos[fonte];
+            ids[destino] = ids[fonte];
+            if (indice)
+            {
+                indice->atualizar(ids[destino], origem + i - 1, origem + i);
+            }
+        }
+        inicio = fisica(1);
+        origem++;
+    }
+    else
+    {
+        // Mais perto do fim: desloca os seguintes uma posição para a esquerda
+        for (int i = posicao; i < ultima; i++)
+        {
+            int destino = fisica(i);
+            int fonte = fisica(i + 1);
+            elementos[destino] = elementos[fonte];
+            ids[destino] = ids[fonte];
+            if (indice)
+            {
+                indice->atualizar(ids[destino], origem + i + 1, origem + i);
+            }
+        }
+    }
+
+    tamanho--;
+    normalizarOrigem();
+    return elementoRemovido;
 }
 
 /**
  * Insere um elemento no início da lista
- * Complexidade: O(n) - Precisa deslocar todos os elementos para a direita
+ * Complexidade: O(1) amortizado - Recua o início do array circular
  */
 bool ListaNaoOrdenada::inserirNoInicio(Elemento *elemento)
 {
-    if (estaCheia() || elemento == nullptr)
+    if (elemento == nullptr || !garantirEspaco())
     {
         return false;
     }
 
-    // Desloca todos os elementos para a direita
-    for (int i = tamanho; i > 0; i--)
+    inicio = (inicio == 0) ? capacidade - 1 : inicio - 1;
+    elementos[inicio] = elemento;
+    ids[inicio] = elemento->getID();
+    origem--;
+    if (indice)
     {
-        elementos[i] = elementos[i - 1];
+        indice->inserir(ids[inicio], origem);
     }
-
-    elementos[0] = elemento;
     tamanho++;
+    normalizarOrigem();
     return true;
 }
 
 /**
  * Insere um elemento no final da lista
- * Complexidade: O(1) - Inserção direta no final
+ * Complexidade: O(1) amortizado - Inserção direta no final (realoca se cheia)
  */
 bool ListaNaoOrdenada::inserirNoFinal(Elemento *elemento)
 {
-    if (estaCheia() || elemento == nullptr)
+    if (elemento == nullptr || !garantirEspaco())
     {
         return false;
     }
 
-    elementos[tamanho] = elemento;
+    int indiceFisico = fisica(tamanho);
+    elementos[indiceFisico] = elemento;
+    ids[indiceFisico] = elemento->getID();
+    if (indice)
+    {
+        indice->inserir(ids[indiceFisico], origem + tamanho);
+    }
     tamanho++;
     return true;
 }
 
 /**
- * Remove o primeiro elemento da lista
- * Complexidade: O(n) - Precisa deslocar todos os elementos para a esquerda
+ * Insere um lote de elementos no final da lista
+ * Valida o lote inteiro antes de alterar a lista, para que a operação seja
+ * tudo ou nada, e copia em no máximo dois blocos (o array é circular)
+ * Complexidade: O(m) amortizado
  */
-Elemento *ListaNaoOrdenada::removerPrimeiro()
+bool ListaNaoOrdenada::inserirVarios(Elemento *const *primeiro, size_t n)
 {
-    if (estaVazia())
+    if (n == 0)
     {
-        return nullptr;
+        return true;
+    }
+    if (primeiro == nullptr || std::find(primeiro, primeiro + n, nullptr) != primeiro + n ||
+        !garantirEspacoPara(n))
+    {
+        return false;
+    }
+
+    int quantidade = static_cast<int>(n);
+    if (indice)
+    {
+        indice->reservar(tamanho + quantidade);
+    }
+
+    int destino = fisica(tamanho);
+    int primeiroBloco = std::min(quantidade, capacidade - destino);
+    std::copy(primeiro, primeiro + primeiroBloco, elementos + destino);
+    std::copy(primeiro + primeiroBloco, primeiro + quantidade, elementos);
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        int indiceFisico = fisica(tamanho + i);
+        ids[indiceFisico] = elementos[indiceFisico]->getID();
+        if (indice)
+        {
+            indice->inserir(ids[indiceFisico], origem + tamanho + i);
+        }
     }
 
-    Elemento *elementoRemovido = elementos[0];
+    tamanho += quantidade;
+    return true;
+}
 
-    // Desloca todos os elementos para a esquerda
-    for (int i = 0; i < tamanho - 1; i++)
+/**
+ * Insere um lote de elementos no início da lista
+ * Recua o início do array circular em m posições e copia o lote em bloco,
+ * sem deslocar nenhum dos elementos existentes
+ * Complexidade: O(m) amortizado
+ */
+bool ListaNaoOrdenada::inserirVariosNoInicio(Elemento *const *primeiro, size_t n)
+{
+    if (n == 0)
     {
-        elementos[i] = elementos[i + 1];
+        return true;
+    }
+    if (primeiro == nullptr || std::find(primeiro, primeiro + n, nullptr) != primeiro + n ||
+        !garantirEspacoPara(n))
+    {
+        return false;
     }
 
-    tamanho--;
-    return elementoRemovido;
+    int quantidade = static_cast<int>(n);
+    if (indice)
+    {
+        indice->reservar(tamanho + quantidade);
+    }
+
+    inicio = (inicio >= quantidade) ? inicio - quantidade : inicio - quantidade + capacidade;
+    origem -= quantidade;
+    tamanho += quantidade;
+
+    int primeiroBloco = std::min(quantidade, capacidade - inicio);
+    std::copy(primeiro, primeiro + primeiroBloco, elementos + inicio);
+    std::copy(primeiro + primeiroBloco, primeiro + quantidade, elementos);
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        int indiceFisico = fisica(i);
+        ids[indiceFisico] = elementos[indiceFisico]->getID();
+        if (indice)
+        {
+            indice->inserir(ids[indiceFisico], origem + i);
+        }
+    }
+
+    normalizarOrigem();
+    return true;
+}
+
+/**
+ * Remove o primeiro elemento da lista
+ * Complexidade: O(1) - Avança o início do array circular (preserva a ordem)
+ */
+Elemento *ListaNaoOrdenada::removerPrimeiro()
+{
+    if (estaVazia())
+    {
+        return nullptr;
+    }
+
+    return removerNaPosicao(0);
 }
 
 /**
@@ -95,55 +429,88 @@ Elemento *ListaNaoOrdenada::removerUltimo()
         return nullptr;
     }
 
-    Elemento *elementoRemovido = elementos[tamanho - 1];
-    tamanho--;
-    return elementoRemovido;
+    return removerNaPosicao(tamanho - 1);
 }
 
 /**
  * Remove um elemento pelo ID
- * Complexidade: O(n) - Busca linear + deslocamento de elementos
+ * Complexidade: O(n) - Busca (linear ou pelo índice) + fechamento do buraco
  */
 Elemento *ListaNaoOrdenada::removerPeloId(int id)
 {
+    int posicao = encontrarPosicao(id);
+    if (posicao == -1)
+    {
+        return nullptr;
+    }
+
+    return removerNaPosicao(posicao);
+}
+
+/**
+ * Remove todos os elementos que satisfazem o predicado
+ * Cada elemento mantido é copiado uma única vez para a próxima posição livre
+ * (compactação estável, independente da política de remoção); o índice hash
+ * é atualizado apenas para os elementos removidos ou deslocados
+ * Complexidade: O(n)
+ */
+int ListaNaoOrdenada::removerSe(const std::function<bool(const Elemento *)> &predicado,
+                                std::vector<Elemento *> *removidos)
+{
+    int destino = 0;
     for (int i = 0; i < tamanho; i++)
     {
-        if (elementos[i]->getID() == id)
-        {
-            Elemento *elementoRemovido = elementos[i];
+        int fonte = fisica(i);
+        Elemento *elemento = elementos[fonte];
 
-            // Desloca elementos para a esquerda
-            for (int j = i; j < tamanho - 1; j++)
+        if (predicado(elemento))
+        {
+            if (indice)
+            {
+                indice->remover(ids[fonte], origem + i);
+            }
+            if (removidos != nullptr)
             {
-                elementos[j] = elementos[j + 1];
+                removidos->push_back(elemento);
             }
+            else
+            {
+                delete elemento;
+            }
+            continue;
+        }
 
-            tamanho--;
-            return elementoRemovido;
+        if (destino != i)
+        {
+            int fisicaDestino = fisica(destino);
+            elementos[fisicaDestino] = elemento;
+            ids[fisicaDestino] = ids[fonte];
+            if (indice)
+            {
+                indice->atualizar(ids[fisicaDestino], origem + i, origem + destino);
+            }
         }
+        destino++;
     }
-    return nullptr;
+
+    int quantidadeRemovida = tamanho - destino;
+    tamanho = destino;
+    return quantidadeRemovida;
 }
 
 /**
  * Busca um elemento pelo ID
- * Complexidade: O(n) - Busca linear
+ * Complexidade: O(1) esperado com índice, O(n) sem índice
  */
 Elemento *ListaNaoOrdenada::buscarPeloId(int id) const
 {
-    for (int i = 0; i < tamanho; i++)
-    {
-        if (elementos[i]->getID() == id)
-        {
-            return elementos[i];
-        }
-    }
-    return nullptr;
+    int posicao = encontrarPosicao(id);
+    return (posicao != -1) ? elementos[fisica(posicao)] : nullptr;
 }
 
 /**
  * Altera um elemento pelo ID
- * Complexidade: O(n) - Busca linear
+ * Complexidade: O(1) esperado com índice, O(n) sem índice
  */
 bool ListaNaoOrdenada::alterarPeloId(int id, Elemento *novoElemento)
 {
@@ -152,16 +519,50 @@ bool ListaNaoOrdenada::alterarPeloId(int id, Elemento *novoElemento)
         return false;
     }
 
+    int posicao = encontrarPosicao(id);
+    if (posicao == -1)
+    {
+        return false;
+    }
+
+    if (indice && novoElemento->getID() != id)
+    {
+        indice->remover(id, origem + posicao);
+        indice->inserir(novoElemento->getID(), origem + posicao);
+    }
+
+    int indiceFisico = fisica(posicao);
+    delete elementos[indiceFisico]; // Libera memória do elemento antigo
+    elementos[indiceFisico] = novoElemento;
+    ids[indiceFisico] = novoElemento->getID();
+    return true;
+}
+
+/**
+ * Ativa o índice hash, indexando os elementos já presentes
+ * Complexidade: O(n)
+ */
+void ListaNaoOrdenada::ativarIndice()
+{
+    if (indice)
+    {
+        return;
+    }
+
+    indice.reset(new IndiceHash(tamanho * 2));
     for (int i = 0; i < tamanho; i++)
     {
-        if (elementos[i]->getID() == id)
-        {
-            delete elementos[i]; // Libera memória do elemento antigo
-            elementos[i] = novoElemento;
-            return true;
-        }
+        indice->inserir(ids[fisica(i)], origem + i);
     }
-    return false;
+}
+
+/**
+ * Desativa o índice hash, liberando sua memória
+ * Complexidade: O(1)
+ */
+void ListaNaoOrdenada::desativarIndice()
+{
+    indice.reset();
 }
 
 /**
@@ -180,7 +581,25 @@ void ListaNaoOrdenada::imprimirTodos() const
     for (int i = 0; i < tamanho; i++)
     {
         std::cout << "Posição " << i << ": ";
-        elementos[i]->imprimirInfo();
+        elementos[fisica(i)]->imprimirInfo();
     }
     std::cout << "Total de elementos: " << tamanho << std::endl;
 }
+
+/**
+ * Visita todos os elementos na ordem da lista
+ * Percorre os dois trechos do array circular sem converter cada posição
+ * Complexidade: O(n)
+ */
+void ListaNaoOrdenada::paraCada(const std::function<void(const Elemento *)> &visitante) const
+{
+    int primeiroTrecho = tamanho < capacidade - inicio ? tamanho : capacidade - inicio;
+    for (int i = 0; i < primeiroTrecho; i++)
+    {
+        visitante(elementos[inicio + i]);
+    }
+    for (int i = 0; i < tamanho - primeiroTrecho; i++)
+    {
+        visitante(elementos[i]);
+    }
+}
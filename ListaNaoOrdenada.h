@@ -2,24 +2,169 @@
 #define LISTA_NAO_ORDENADA_H
 
 #include "Elemento.h"
+#include "IndiceHash.h"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
 
 /**
  * Classe que implementa uma Lista Não Ordenada com alocação sequencial.
+ * O array de ponteiros cresce geometricamente quando fica cheio, de modo que
+ * a inserção no final tem custo O(1) amortizado e a lista não tem limite fixo.
+ * O array é usado de forma circular (a posição 0 da lista fica em "inicio"),
+ * o que torna inserção e remoção em ambas as extremidades O(1).
+ * Opcionalmente mantém um índice hash ID → posição, tornando buscas, remoções
+ * e alterações pelo ID O(1) esperado (mais o deslocamento, no caso da remoção).
+ * Os IDs são replicados em um array de int paralelo, para que a busca linear
+ * percorra memória contígua com instruções SIMD sem acessar cada objeto.
+ * Como a ordem não é significativa, a política de remoção TROCAR_COM_ULTIMO
+ * preenche o buraco com o último elemento em vez de deslocar os seguintes.
  * Demonstra o pilar do Encapsulamento ao esconder os detalhes de implementação.
  */
 class ListaNaoOrdenada
 {
+public:
+    /**
+     * Política usada para fechar o buraco deixado por uma remoção
+     */
+    enum PoliticaRemocao
+    {
+        PRESERVAR_ORDEM,  // Desloca os elementos seguintes: O(n), mantém a ordem de inserção
+        TROCAR_COM_ULTIMO // Move o último elemento para o buraco: O(1), altera a ordem
+    };
+
 private:
-    static const int TAMANHO_MAX = 100; // Capacidade máxima da lista
-    Elemento **elementos;               // Array de ponteiros para elementos
-    int tamanho;                        // Número atual de elementos na lista
-    int capacidade;                     // Capacidade máxima da lista
+    static const int CAPACIDADE_INICIAL = 16; // Capacidade alocada na construção
+    static const int CAPACIDADE_MAXIMA;       // Maior capacidade representável
+    Elemento **elementos;                     // Array circular de ponteiros para elementos
+    int *ids;                                 // IDs dos elementos, na mesma ordem de elementos
+    int inicio;                               // Índice físico do primeiro elemento
+    int tamanho;                              // Número atual de elementos na lista
+    int capacidade;                           // Capacidade atual do array
+    int origem;                               // Valor no índice hash da posição 0 (ver ativarIndice)
+    double fatorCrescimento;                  // Fator aplicado à capacidade a cada realocação
+    std::unique_ptr<IndiceHash> indice;       // Índice ID → posição (nullptr se desativado)
+    PoliticaRemocao politicaRemocao;          // Como as remoções fecham o buraco
+
+    /**
+     * Converte uma posição da lista no índice físico do array circular
+     * @param posicao Posição na lista (0 <= posicao < capacidade)
+     * @return Índice físico correspondente
+     * Complexidade: O(1)
+     */
+    int fisica(int posicao) const
+    {
+        int indiceFisico = inicio + posicao;
+        return indiceFisico < capacidade ? indiceFisico : indiceFisico - capacidade;
+    }
+
+    /**
+     * Realoca os arrays para a capacidade informada, copiando os elementos e IDs
+     * Os elementos são copiados em ordem, a partir do índice físico 0
+     * @param novaCapacidade Nova capacidade (deve ser >= tamanho)
+     * @return true se realocado com sucesso, false se faltou memória
+     * Complexidade: O(n) - Copia todos os ponteiros e IDs
+     */
+    bool realocar(int novaCapacidade);
+
+    /**
+     * Calcula a capacidade a alocar para comportar pelo menos "minimo" elementos,
+     * crescendo geometricamente
+     * @param minimo Número de elementos que precisa caber
+     * @return Nova capacidade, ou -1 se excede a capacidade máxima
+     * Complexidade: O(1)
+     */
+    int calcularCrescimento(long long minimo) const;
+
+    /**
+     * Garante espaço para pelo menos "quantidade" elementos além dos atuais
+     * @param quantidade Número de elementos a inserir
+     * @return true se há espaço disponível, false caso contrário
+     * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+     */
+    bool garantirEspacoPara(size_t quantidade);
+
+    /**
+     * Garante espaço para pelo menos mais um elemento, crescendo geometricamente
+     * @return true se há espaço disponível, false caso contrário
+     * Complexidade: O(1) amortizado
+     */
+    bool garantirEspaco();
+
+    /**
+     * Reconstrói o índice hash com origem 0 quando a origem se aproxima
+     * dos limites de int (após bilhões de operações no início da lista)
+     * Complexidade: O(1) normalmente, O(n) quando precisa reconstruir
+     */
+    void normalizarOrigem();
+
+    /**
+     * Encontra a posição do primeiro elemento com o ID informado
+     * @param id ID do elemento procurado
+     * @return Posição do elemento ou -1 se não encontrado
+     * Complexidade: O(1) esperado com índice, O(n) sem índice
+     */
+    int encontrarPosicao(int id) const;
+
+    /**
+     * Remove o elemento da posição informada, fechando o buraco conforme a política
+     * Ao preservar a ordem, desloca o lado mais curto (início ou fim) do array circular
+     * @param posicao Posição válida do elemento
+     * @return Ponteiro para o elemento removido
+     * Complexidade: O(min(posicao, n - posicao)) ao preservar a ordem, O(1) ao trocar
+     */
+    Elemento *removerNaPosicao(int posicao);
 
 public:
+    /**
+     * Iterador constante compatível com a STL (forward iterator), que percorre
+     * os elementos na ordem da lista, convertendo cada posição em índice físico
+     * Complexidade: O(1) por avanço
+     */
+    class Iterador
+    {
+    private:
+        const ListaNaoOrdenada *lista; // Lista percorrida
+        int posicao;                   // Posição atual na lista (tamanho no fim)
+
+        Iterador(const ListaNaoOrdenada *lista, int posicao) : lista(lista), posicao(posicao) {}
+        friend class ListaNaoOrdenada;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Elemento *value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Elemento *const *pointer;
+        typedef Elemento *const &reference;
+
+        Iterador() : lista(nullptr), posicao(0) {}
+        reference operator*() const { return lista->elementos[lista->fisica(posicao)]; }
+        pointer operator->() const { return &lista->elementos[lista->fisica(posicao)]; }
+        Iterador &operator++()
+        {
+            posicao++;
+            return *this;
+        }
+        Iterador operator++(int)
+        {
+            Iterador anterior = *this;
+            posicao++;
+            return anterior;
+        }
+        bool operator==(const Iterador &outro) const { return posicao == outro.posicao; }
+        bool operator!=(const Iterador &outro) const { return posicao != outro.posicao; }
+    };
+
     /**
      * Construtor da Lista Não Ordenada
+     * @param capacidadeInicial Número de posições alocadas inicialmente
+     * @param fatorCrescimento Fator de crescimento da capacidade (deve ser > 1)
+     * @param politicaRemocao Como as remoções fecham o buraco deixado no array
      */
-    ListaNaoOrdenada();
+    ListaNaoOrdenada(int capacidadeInicial = CAPACIDADE_INICIAL, double fatorCrescimento = 2.0,
+                     PoliticaRemocao politicaRemocao = PRESERVAR_ORDEM);
 
     /**
      * Destrutor da Lista Não Ordenada
@@ -30,7 +175,7 @@ public:
      * Insere um elemento no início da lista
      * @param elemento Ponteiro para o elemento a ser inserido
      * @return true se inserido com sucesso, false caso contrário
-     * Complexidade: O(n) - Precisa deslocar todos os elementos
+     * Complexidade: O(1) amortizado - Recua o início do array circular
      */
     bool inserirNoInicio(Elemento *elemento);
 
@@ -38,14 +183,37 @@ public:
      * Insere um elemento no final da lista
      * @param elemento Ponteiro para o elemento a ser inserido
      * @return true se inserido com sucesso, false caso contrário
-     * Complexidade: O(1) - Inserção direta no final
+     * Complexidade: O(1) amortizado - Inserção direta no final (realoca se cheia)
      */
     bool inserirNoFinal(Elemento *elemento);
 
+    /**
+     * Insere um lote de elementos no final da lista, na ordem do lote
+     * Reserva espaço uma única vez e copia o lote em bloco
+     * @param primeiro Ponteiro para o primeiro ponteiro do lote
+     * @param n Número de elementos do lote
+     * @return true se todos foram inseridos, false (sem inserir nenhum) se algum
+     * ponteiro é nulo ou faltou memória
+     * Complexidade: O(m) amortizado, com m o tamanho do lote
+     */
+    bool inserirVarios(Elemento *const *primeiro, size_t n);
+
+    /**
+     * Insere um lote de elementos no início da lista, na ordem do lote
+     * (primeiro[0] passa a ser o primeiro elemento da lista)
+     * Reserva espaço uma única vez e copia o lote em bloco antes do início circular
+     * @param primeiro Ponteiro para o primeiro ponteiro do lote
+     * @param n Número de elementos do lote
+     * @return true se todos foram inseridos, false (sem inserir nenhum) se algum
+     * ponteiro é nulo ou faltou memória
+     * Complexidade: O(m) amortizado, com m o tamanho do lote
+     */
+    bool inserirVariosNoInicio(Elemento *const *primeiro, size_t n);
+
     /**
      * Remove o primeiro elemento da lista
      * @return Ponteiro para o elemento removido ou nullptr se vazia
-     * Complexidade: O(n) - Precisa deslocar todos os elementos
+     * Complexidade: O(1) - Avança o início do array circular (preserva a ordem)
      */
     Elemento *removerPrimeiro();
 
@@ -60,15 +228,27 @@ public:
      * Remove um elemento pelo ID
      * @param id ID do elemento a ser removido
      * @return Ponteiro para o elemento removido ou nullptr se não encontrado
-     * Complexidade: O(n) - Busca linear + deslocamento
+     * Complexidade: O(n) - Busca (linear ou pelo índice) + deslocamento do lado mais curto
+     * (com índice e TROCAR_COM_ULTIMO, O(1) esperado)
      */
     Elemento *removerPeloId(int id);
 
+    /**
+     * Remove, em uma única passada, todos os elementos que satisfazem o predicado
+     * @param predicado Função que recebe um elemento e retorna true se ele deve sair
+     * @param removidos Se informado, recebe os elementos removidos (na ordem da lista)
+     * e o chamador passa a ser dono deles; se nullptr, os elementos são liberados
+     * @return Número de elementos removidos
+     * Complexidade: O(n) - Compacta o array preservando a ordem
+     */
+    int removerSe(const std::function<bool(const Elemento *)> &predicado,
+                  std::vector<Elemento *> *removidos = nullptr);
+
     /**
      * Busca um elemento pelo ID
      * @param id ID do elemento a ser buscado
      * @return Ponteiro para o elemento encontrado ou nullptr se não encontrado
-     * Complexidade: O(n) - Busca linear
+     * Complexidade: O(1) esperado com índice, O(n) sem índice
      */
     Elemento *buscarPeloId(int id) const;
 
@@ -77,10 +257,45 @@ public:
      * @param id ID do elemento a ser alterado
      * @param novoElemento Ponteiro para o novo elemento
      * @return true se alterado com sucesso, false caso contrário
-     * Complexidade: O(n) - Busca linear
+     * Complexidade: O(1) esperado com índice, O(n) sem índice
      */
     bool alterarPeloId(int id, Elemento *novoElemento);
 
+    /**
+     * Ativa o índice hash ID → posição, indexando os elementos atuais
+     * O índice guarda origem + posição, de modo que inserir ou remover no início
+     * só altera a origem, sem atualizar as demais entradas
+     * Complexidade: O(n)
+     */
+    void ativarIndice();
+
+    /**
+     * Desativa o índice hash, voltando à busca linear
+     * Complexidade: O(1)
+     */
+    void desativarIndice();
+
+    /**
+     * Verifica se o índice hash está ativo
+     * @return true se ativo, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool indiceAtivo() const { return indice != nullptr; }
+
+    /**
+     * Reserva espaço para pelo menos n elementos, evitando realocações futuras
+     * @param n Capacidade mínima desejada
+     * @return true se a capacidade foi garantida, false se faltou memória
+     * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+     */
+    bool reservar(int n);
+
+    /**
+     * Reduz a capacidade do array ao número atual de elementos
+     * Complexidade: O(n) - Realoca e copia os ponteiros
+     */
+    void encolher();
+
     /**
      * Verifica se a lista está vazia
      * @return true se vazia, false caso contrário
@@ -90,10 +305,11 @@ public:
 
     /**
      * Verifica se a lista está cheia
+     * Como o array cresce sob demanda, só fica cheia ao atingir a capacidade máxima
      * @return true se cheia, false caso contrário
      * Complexidade: O(1)
      */
-    bool estaCheia() const { return tamanho >= capacidade; }
+    bool estaCheia() const { return tamanho >= CAPACIDADE_MAXIMA; }
 
     /**
      * Obtém o tamanho atual da lista
@@ -102,11 +318,58 @@ public:
      */
     int getTamanho() const { return tamanho; }
 
+    /**
+     * Obtém o primeiro elemento da lista, sem removê-lo
+     * @return Ponteiro para o elemento ou nullptr se vazia
+     * Complexidade: O(1) - Acesso direto ao início do array circular
+     */
+    Elemento *primeiro() const { return tamanho > 0 ? elementos[inicio] : nullptr; }
+
+    /**
+     * Obtém o último elemento da lista, sem removê-lo
+     * @return Ponteiro para o elemento ou nullptr se vazia
+     * Complexidade: O(1) - Acesso direto ao final do array circular
+     */
+    Elemento *ultimo() const { return tamanho > 0 ? elementos[fisica(tamanho - 1)] : nullptr; }
+
+    /**
+     * Obtém a capacidade atualmente alocada
+     * @return Número de posições disponíveis sem realocação
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const { return capacidade; }
+
+    /**
+     * Obtém a política de remoção da lista
+     * @return Política definida na construção
+     * Complexidade: O(1)
+     */
+    PoliticaRemocao getPoliticaRemocao() const { return politicaRemocao; }
+
     /**
      * Imprime todos os elementos da lista
      * Complexidade: O(n)
      */
     void imprimirTodos() const;
+
+    /**
+     * Visita todos os elementos na ordem da lista, sem cópias nem impressão
+     * @param visitante Função chamada uma vez para cada elemento
+     * Complexidade: O(n)
+     */
+    void paraCada(const std::function<void(const Elemento *)> &visitante) const;
+
+    /**
+     * Iterador para o primeiro elemento
+     * Complexidade: O(1)
+     */
+    Iterador begin() const { return Iterador(this, 0); }
+
+    /**
+     * Iterador para depois do último elemento
+     * Complexidade: O(1)
+     */
+    Iterador end() const { return Iterador(this, tamanho); }
 };
 
 #endif // LISTA_NAO_ORDENADA_H
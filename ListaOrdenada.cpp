@@ -1,13 +1,30 @@
 #include "ListaOrdenada.h"
+#include "OperacoesVetoriais.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+const int ListaOrdenada::CAPACIDADE_MAXIMA = std::numeric_limits<int>::max();
 
 /**
  * Construtor da Lista Ordenada
  * Complexidade: O(1)
  */
-ListaOrdenada::ListaOrdenada() : tamanho(0), capacidade(TAMANHO_MAX)
+ListaOrdenada::ListaOrdenada(int capacidadeInicial, double fatorCrescimento)
+    : tamanho(0),
+      capacidade(capacidadeInicial > 0 ? capacidadeInicial : 1),
+      fatorCrescimento(fatorCrescimento > 1.0 ? fatorCrescimento : 2.0),
+      limiteMinimoBuffer(0),
+      erroIndice(0),
+      indiceValido(false),
+      alteracoesPendentes(0)
 {
     elementos = new Elemento *[capacidade];
+    ids = new int[capacidade];
 }
 
 /**
@@ -20,72 +37,363 @@ ListaOrdenada::~ListaOrdenada()
     {
         delete elementos[i];
     }
+    for (size_t i = 0; i < buffer.size(); i++)
+    {
+        delete buffer[i].second;
+    }
+    delete[] elementos;
+    delete[] ids;
+}
+
+/**
+ * Realoca os arrays para a capacidade informada, copiando os elementos e IDs
+ * Usa new (std::nothrow) para que a falta de memória seja reportada como retorno false
+ * Complexidade: O(n) - Copia todos os ponteiros e IDs
+ */
+bool ListaOrdenada::realocar(int novaCapacidade)
+{
+    Elemento **novoArray = new (std::nothrow) Elemento *[novaCapacidade];
+    int *novosIds = new (std::nothrow) int[novaCapacidade];
+    if (novoArray == nullptr || novosIds == nullptr)
+    {
+        delete[] novoArray;
+        delete[] novosIds;
+        return false;
+    }
+
+    std::copy(elementos, elementos + tamanho, novoArray);
+    std::copy(ids, ids + tamanho, novosIds);
+
     delete[] elementos;
+    delete[] ids;
+    elementos = novoArray;
+    ids = novosIds;
+    capacidade = novaCapacidade;
+    return true;
+}
+
+/**
+ * Calcula a capacidade a alocar para comportar pelo menos "minimo" elementos
+ * Multiplica a capacidade atual por fatorCrescimento até caber
+ * Complexidade: O(1)
+ */
+int ListaOrdenada::calcularCrescimento(long long minimo) const
+{
+    if (minimo > CAPACIDADE_MAXIMA)
+    {
+        return -1;
+    }
+
+    double desejada = capacidade * fatorCrescimento;
+    if (desejada < minimo)
+    {
+        desejada = static_cast<double>(minimo);
+    }
+    return desejada >= CAPACIDADE_MAXIMA ? CAPACIDADE_MAXIMA : static_cast<int>(desejada);
+}
+
+/**
+ * Garante espaço para pelo menos "quantidade" elementos além dos atuais
+ * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+ */
+bool ListaOrdenada::garantirEspacoPara(size_t quantidade)
+{
+    if (quantidade <= static_cast<size_t>(capacidade - tamanho))
+    {
+        return true;
+    }
+
+    if (quantidade > static_cast<size_t>(CAPACIDADE_MAXIMA))
+    {
+        return false;
+    }
+    long long minimo = static_cast<long long>(tamanho) + static_cast<long long>(quantidade);
+    int novaCapacidade = calcularCrescimento(minimo);
+    return novaCapacidade != -1 && realocar(novaCapacidade);
+}
+
+/**
+ * Garante espaço para pelo menos mais um elemento
+ * Complexidade: O(1) amortizado
+ */
+bool ListaOrdenada::garantirEspaco()
+{
+    return garantirEspacoPara(1);
+}
+
+/**
+ * Reserva espaço para pelo menos n elementos
+ * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+ */
+bool ListaOrdenada::reservar(int n)
+{
+    if (n <= capacidade)
+    {
+        return true;
+    }
+    return realocar(n);
+}
+
+/**
+ * Reduz a capacidade do array ao número atual de elementos
+ * Complexidade: O(n) - Realoca e copia os ponteiros
+ */
+void ListaOrdenada::encolher()
+{
+    consolidar();
+
+    int novaCapacidade = tamanho > 0 ? tamanho : 1;
+    if (novaCapacidade < capacidade)
+    {
+        // Em caso de falta de memória, mantém o array atual
+        realocar(novaCapacidade);
+    }
+}
+
+/**
+ * Limite inferior em um array ordenado de int
+ * A cada passo o intervalo [base, base + restante) perde a metade inferior ou
+ * a superior; o avanço de base é calculado por multiplicação, sem desvio
+ * condicional, e as posições que o próximo passo pode comparar (o meio de cada
+ * metade) são carregadas antecipadamente, enquanto a comparação atual é resolvida
+ * Complexidade: O(log n)
+ */
+int ListaOrdenada::limiteInferior(const int *chaves, int n, int id)
+{
+    if (n <= 0)
+    {
+        return 0;
+    }
+
+    const int *base = chaves;
+    int restante = n;
+    while (restante > 1)
+    {
+        int metade = restante / 2;
+        restante -= metade;
+        __builtin_prefetch(base + restante / 2 - 1);
+        __builtin_prefetch(base + metade + restante / 2 - 1);
+        base += (base[metade - 1] < id) * metade;
+    }
+
+    return static_cast<int>(base - chaves) + (*base < id);
 }
 
 /**
- * Encontra a posição correta para inserir um elemento (busca binária)
+ * Encontra a posição correta para inserir um elemento (limite inferior)
+ * Com o índice aprendido válido, a busca fica restrita à janela prevista por
+ * ele; com o índice k-ário válido, desce a árvore dele
  * Complexidade: O(log n) - Busca binária
  */
 int ListaOrdenada::encontrarPosicaoInsercao(int id) const
 {
-    int esquerda = 0;
-    int direita = tamanho;
+    if (indiceValido)
+    {
+        return indiceKario ? indiceKario->limiteInferior(id) : buscarNoIndice(id);
+    }
+    return limiteInferior(ids, tamanho, id);
+}
 
-    while (esquerda < direita)
+/**
+ * Encontra a posição de inserção de um ID usando o índice aprendido
+ * O trecho é o último com primeiraChave <= id. IDs entre o último ponto de um
+ * trecho e o primeiro do seguinte têm todos a mesma posição de inserção, o
+ * início do trecho seguinte. Nos demais, a posição está a no máximo erroIndice
+ * posições da prevista (uma a mais de cada lado absorve o arredondamento)
+ * Complexidade: O(log s + log e)
+ */
+int ListaOrdenada::buscarNoIndice(int id) const
+{
+    // Índice do primeiro trecho com primeiraChave > id
+    int numeroTrechos = static_cast<int>(chavesIndice.size());
+    int seguinte = id == std::numeric_limits<int>::max()
+                       ? numeroTrechos
+                       : limiteInferior(chavesIndice.data(), numeroTrechos, id + 1);
+    if (seguinte == 0)
     {
-        int meio = esquerda + (direita - esquerda) / 2;
+        return 0; // Menor que todos os IDs
+    }
 
-        if (elementos[meio]->getID() < id)
-        {
-            esquerda = meio + 1;
-        }
-        else
-        {
-            direita = meio;
-        }
+    const SegmentoIndice &segmento = indice[seguinte - 1];
+    int limiteSuperior = seguinte == numeroTrechos ? tamanho : indice[seguinte].posicaoInicial;
+    if (id > segmento.ultimaChave)
+    {
+        return limiteSuperior;
     }
 
-    return esquerda;
+    double prevista = segmento.posicaoInicial +
+                      segmento.inclinacao * (static_cast<double>(id) - segmento.primeiraChave);
+    int inicio = std::max(segmento.posicaoInicial, static_cast<int>(prevista) - erroIndice - 1);
+    int fim = std::min(limiteSuperior, static_cast<int>(prevista) + erroIndice + 2);
+    return inicio + limiteInferior(ids + inicio, fim - inicio, id);
 }
 
 /**
- * Encontra a posição de um elemento pelo ID (busca binária)
- * Complexidade: O(log n) - Busca binária
+ * Reconstrói o índice ativo se ele está desatualizado
+ * As buscas (const) nunca o reconstroem: só leem o índice quando ele está
+ * válido, e por isso podem rodar em várias threads ao mesmo tempo
+ * O índice k-ário é construído por IndiceKario. No aprendido, os pontos do modelo são (ID, posição da primeira ocorrência) de cada ID
+ * distinto e, quando o próximo ID não é consecutivo, (ID + 1, posição do
+ * próximo): assim a reta também limita o erro dos IDs ausentes. Cada trecho
+ * passa pelo seu primeiro ponto e mantém o cone de inclinações que deixam
+ * todos os pontos seguintes a no máximo erroIndice posições; quando o cone
+ * fica vazio, o ponto abre um novo trecho (como no FITing-tree)
+ * Complexidade: O(n) se precisar reconstruir, O(1) caso contrário
  */
-int ListaOrdenada::encontrarPosicaoElemento(int id) const
+void ListaOrdenada::atualizarIndice()
 {
-    int esquerda = 0;
-    int direita = tamanho - 1;
+    alteracoesPendentes = 0;
+    if (indiceValido)
+    {
+        return;
+    }
+    if (indiceKario)
+    {
+        // Em caso de falta de memória, as buscas continuam binárias
+        indiceValido = indiceKario->construir(ids, tamanho);
+        return;
+    }
+    if (erroIndice == 0)
+    {
+        return;
+    }
+
+    indice.clear();
+    chavesIndice.clear();
+    SegmentoIndice atual = SegmentoIndice();
+    double inclinacaoMinima = 0.0;
+    double inclinacaoMaxima = std::numeric_limits<double>::infinity();
 
-    while (esquerda <= direita)
+    auto fecharTrecho = [&]()
+    {
+        atual.inclinacao = inclinacaoMaxima == std::numeric_limits<double>::infinity()
+                               ? inclinacaoMinima
+                               : (inclinacaoMinima + inclinacaoMaxima) / 2;
+        indice.push_back(atual);
+        chavesIndice.push_back(atual.primeiraChave);
+    };
+    auto adicionarPonto = [&](long long chave, int posicao)
     {
-        int meio = esquerda + (direita - esquerda) / 2;
+        double deltaChave = static_cast<double>(chave - atual.primeiraChave);
+        double minimo = std::max(inclinacaoMinima, (posicao - erroIndice - atual.posicaoInicial) / deltaChave);
+        double maximo = std::min(inclinacaoMaxima, (posicao + erroIndice - atual.posicaoInicial) / deltaChave);
+        if (minimo <= maximo)
+        {
+            inclinacaoMinima = minimo;
+            inclinacaoMaxima = maximo;
+            atual.ultimaChave = static_cast<int>(chave);
+            return;
+        }
 
-        if (elementos[meio]->getID() == id)
+        fecharTrecho();
+        atual.primeiraChave = atual.ultimaChave = static_cast<int>(chave);
+        atual.posicaoInicial = posicao;
+        inclinacaoMinima = 0.0;
+        inclinacaoMaxima = std::numeric_limits<double>::infinity();
+    };
+
+    int i = 0;
+    while (i < tamanho)
+    {
+        int proximo = i + 1;
+        while (proximo < tamanho && ids[proximo] == ids[i])
         {
-            return meio;
+            proximo++;
         }
-        else if (elementos[meio]->getID() < id)
+
+        if (i == 0)
         {
-            esquerda = meio + 1;
+            atual.primeiraChave = atual.ultimaChave = ids[0];
+            atual.posicaoInicial = 0;
         }
         else
         {
-            direita = meio - 1;
+            adicionarPonto(ids[i], i);
+        }
+        if (proximo < tamanho && static_cast<long long>(ids[proximo]) > static_cast<long long>(ids[i]) + 1)
+        {
+            adicionarPonto(static_cast<long long>(ids[i]) + 1, proximo);
         }
+        i = proximo;
+    }
+    if (tamanho > 0)
+    {
+        fecharTrecho();
+    }
+    indiceValido = true;
+}
+
+/**
+ * Registra uma alteração individual do array
+ * Reconstruir o índice a cada max(ALTERACOES_MINIMAS_INDICE, √n) alterações
+ * custa O(√n) amortizado por alteração, como a descarga do buffer de escrita
+ * Complexidade: O(√n) amortizado
+ */
+void ListaOrdenada::registrarAlteracao()
+{
+    indiceValido = false;
+    if (!indiceAprendidoAtivo() && !indiceKarioAtivo())
+    {
+        return;
+    }
+
+    int limite = static_cast<int>(std::sqrt(static_cast<double>(tamanho)));
+    if (limite < ALTERACOES_MINIMAS_INDICE)
+    {
+        limite = ALTERACOES_MINIMAS_INDICE;
     }
+    if (++alteracoesPendentes >= limite)
+    {
+        atualizarIndice();
+    }
+}
 
+/**
+ * Encontra a posição de um elemento pelo ID (busca binária)
+ * Complexidade: O(log n) - Busca binária
+ */
+int ListaOrdenada::encontrarPosicaoElemento(int id) const
+{
+    int posicao = encontrarPosicaoInsercao(id);
+    if (posicao < tamanho && ids[posicao] == id)
+    {
+        return posicao;
+    }
     return -1; // Não encontrado
 }
 
+/**
+ * Encontra a posição de um elemento pelo ID no buffer de escrita
+ * Complexidade: O(log m)
+ */
+int ListaOrdenada::encontrarNoBuffer(int id) const
+{
+    std::vector<std::pair<int, Elemento *>>::const_iterator posicao =
+        std::lower_bound(buffer.begin(), buffer.end(), id,
+                         [](const std::pair<int, Elemento *> &entrada, int chave)
+                         { return entrada.first < chave; });
+    if (posicao != buffer.end() && posicao->first == id)
+    {
+        return static_cast<int>(posicao - buffer.begin());
+    }
+    return -1;
+}
+
 /**
  * Insere um elemento mantendo a ordem (implementação para inserirNoInicio)
  * Complexidade: O(n) - Busca O(log n) + inserção O(n)
  */
 bool ListaOrdenada::inserirNoInicio(Elemento *elemento)
 {
-    if (estaCheia() || elemento == nullptr)
+    if (elemento == nullptr)
+    {
+        return false;
+    }
+    if (bufferEscritaAtivo())
+    {
+        return inserirNoBuffer(elemento);
+    }
+    if (!garantirEspaco())
     {
         return false;
     }
@@ -93,14 +401,14 @@ bool ListaOrdenada::inserirNoInicio(Elemento *elemento)
     // Encontra posição correta para manter ordem
     int posicao = encontrarPosicaoInsercao(elemento->getID());
 
-    // Desloca elementos para a direita
-    for (int i = tamanho; i > posicao; i--)
-    {
-        elementos[i] = elementos[i - 1];
-    }
+    // Desloca elementos e IDs para a direita (cada array em um bloco só)
+    std::copy_backward(elementos + posicao, elementos + tamanho, elementos + tamanho + 1);
+    std::copy_backward(ids + posicao, ids + tamanho, ids + tamanho + 1);
 
     elementos[posicao] = elemento;
+    ids[posicao] = elemento->getID();
     tamanho++;
+    registrarAlteracao();
     return true;
 }
 
@@ -115,12 +423,284 @@ bool ListaOrdenada::inserirNoFinal(Elemento *elemento)
     return inserirNoInicio(elemento);
 }
 
+/**
+ * Insere um lote de elementos mantendo a ordem
+ * Complexidade: O(n + m log m)
+ */
+bool ListaOrdenada::inserirVarios(Elemento *const *primeiro, size_t n)
+{
+    return mesclar(primeiro, n);
+}
+
+/**
+ * Intercala no array um lote já ordenado pelo ID
+ * A intercalação começa pelo fim: o maior dos dois finais vai para a última
+ * posição livre, de modo que nenhuma posição é sobrescrita antes de ser lida.
+ * Em caso de empate de IDs, o elemento do lote fica antes do existente, como
+ * em inserirNoInicio. Como a intercalação já custa O(n + m), o índice ativo
+ * é reconstruído logo em seguida
+ * Complexidade: O(n + m)
+ */
+bool ListaOrdenada::intercalar(const std::pair<int, Elemento *> *lote, size_t n)
+{
+    if (!garantirEspacoPara(n))
+    {
+        return false;
+    }
+
+    // Os existentes menores que todo o lote não se movem
+    int i = tamanho - 1;
+    long long j = static_cast<long long>(n) - 1;
+    int k = tamanho + static_cast<int>(n) - 1;
+    while (j >= 0)
+    {
+        if (i >= 0 && ids[i] >= lote[j].first)
+        {
+            ids[k] = ids[i];
+            elementos[k--] = elementos[i--];
+        }
+        else
+        {
+            ids[k] = lote[j].first;
+            elementos[k--] = lote[j--].second;
+        }
+    }
+
+    tamanho += static_cast<int>(n);
+    indiceValido = false;
+    atualizarIndice();
+    return true;
+}
+
+/**
+ * Mescla um lote de elementos na lista, mantendo a ordem
+ * O lote é copiado com os IDs ao lado dos ponteiros, para que a ordenação e a
+ * intercalação comparem apenas inteiros
+ * Complexidade: O(n + m), mais O(m log m) se o lote não vier ordenado
+ */
+bool ListaOrdenada::mesclar(Elemento *const *primeiro, size_t n)
+{
+    if (n == 0)
+    {
+        return true;
+    }
+    if (primeiro == nullptr)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        if (primeiro[i] == nullptr)
+        {
+            return false;
+        }
+    }
+    if (n > static_cast<size_t>(CAPACIDADE_MAXIMA - getTamanho()))
+    {
+        return false;
+    }
+    consolidar();
+
+    std::vector<std::pair<int, Elemento *>> lote(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        lote[i] = std::make_pair(primeiro[i]->getID(), primeiro[i]);
+    }
+    auto menorId = [](const std::pair<int, Elemento *> &a, const std::pair<int, Elemento *> &b)
+    { return a.first < b.first; };
+    if (!std::is_sorted(lote.begin(), lote.end(), menorId))
+    {
+        std::stable_sort(lote.begin(), lote.end(), menorId);
+    }
+    return intercalar(lote.data(), n);
+}
+
+/**
+ * Insere um elemento no buffer de escrita
+ * O buffer é mantido ordenado (inserir nele desloca no máximo ~√n pares),
+ * para que as buscas continuem binárias e o descarregamento seja só a
+ * intercalação. Entre IDs iguais, o mais recente fica antes, como no array
+ * Complexidade: O(√n) amortizado - Deslocamento no buffer + intercalação
+ * O(n) a cada ~√n inserções
+ */
+bool ListaOrdenada::inserirNoBuffer(Elemento *elemento)
+{
+    if (estaCheia())
+    {
+        return false;
+    }
+
+    int id = elemento->getID();
+    std::vector<std::pair<int, Elemento *>>::iterator posicao =
+        std::lower_bound(buffer.begin(), buffer.end(), id,
+                         [](const std::pair<int, Elemento *> &entrada, int chave)
+                         { return entrada.first < chave; });
+    buffer.insert(posicao, std::make_pair(id, elemento));
+
+    int limite = std::max(limiteMinimoBuffer, static_cast<int>(std::sqrt(static_cast<double>(tamanho))));
+    if (static_cast<int>(buffer.size()) >= limite)
+    {
+        descarregarBuffer();
+    }
+    return true;
+}
+
+/**
+ * Mescla o buffer de escrita no array principal e o esvazia
+ * Se faltar memória, os elementos continuam no buffer (e visíveis às buscas)
+ * Complexidade: O(n + m)
+ */
+void ListaOrdenada::descarregarBuffer()
+{
+    if (!buffer.empty() && intercalar(buffer.data(), buffer.size()))
+    {
+        buffer.clear();
+    }
+}
+
+/**
+ * Mescla no array principal as inserções pendentes no buffer de escrita
+ * Complexidade: O(n + m) se há inserções pendentes, O(1) caso contrário
+ */
+void ListaOrdenada::consolidar()
+{
+    descarregarBuffer();
+}
+
+/**
+ * Preenche a visão consolidada da lista sem descarregar o buffer de escrita
+ * A cópia segue o desempate de intercalar: um ID repetido do buffer fica
+ * antes do que já estava no array
+ * Complexidade: O(1), ou O(n + m) se há inserções pendentes no buffer
+ */
+void ListaOrdenada::obterConsolidada(Consolidada &visao) const
+{
+    if (buffer.empty())
+    {
+        visao.elementos = elementos;
+        visao.ids = ids;
+        visao.tamanho = tamanho;
+        return;
+    }
+
+    int total = getTamanho();
+    visao.copiaElementos.resize(total);
+    visao.copiaIds.resize(total);
+    size_t j = 0;
+    int i = 0;
+    for (int k = 0; k < total; k++)
+    {
+        if (j < buffer.size() && (i == tamanho || buffer[j].first <= ids[i]))
+        {
+            visao.copiaIds[k] = buffer[j].first;
+            visao.copiaElementos[k] = buffer[j++].second;
+        }
+        else
+        {
+            visao.copiaIds[k] = ids[i];
+            visao.copiaElementos[k] = elementos[i++];
+        }
+    }
+    visao.elementos = visao.copiaElementos.data();
+    visao.ids = visao.copiaIds.data();
+    visao.tamanho = total;
+}
+
+/**
+ * Ativa o buffer de escrita
+ * Complexidade: O(1)
+ */
+void ListaOrdenada::ativarBufferEscrita(int limiteMinimo)
+{
+    limiteMinimoBuffer = limiteMinimo > 0 ? limiteMinimo : 1;
+}
+
+/**
+ * Desativa o buffer de escrita, descarregando os elementos pendentes
+ * Complexidade: O(n + m)
+ */
+void ListaOrdenada::desativarBufferEscrita()
+{
+    consolidar();
+    limiteMinimoBuffer = 0;
+}
+
+/**
+ * Ativa o índice aprendido e constrói o modelo
+ * Complexidade: O(n) - Constrói o modelo, se ainda não estava construído
+ */
+void ListaOrdenada::ativarIndiceAprendido(int erroMaximo)
+{
+    desativarIndiceKario();
+    int erro = erroMaximo > 0 ? erroMaximo : 1;
+    if (erro != erroIndice)
+    {
+        erroIndice = erro;
+        indiceValido = false;
+    }
+    atualizarIndice();
+}
+
+/**
+ * Desativa o índice aprendido e libera o modelo
+ * Complexidade: O(1)
+ */
+void ListaOrdenada::desativarIndiceAprendido()
+{
+    if (erroIndice == 0)
+    {
+        return;
+    }
+    erroIndice = 0;
+    indiceValido = false;
+    std::vector<SegmentoIndice>().swap(indice);
+    std::vector<int>().swap(chavesIndice);
+}
+
+/**
+ * Ativa o índice k-ário e o constrói
+ * Se faltar memória, as buscas continuam binárias
+ * Complexidade: O(n) - Constrói o índice, se ainda não estava construído
+ */
+void ListaOrdenada::ativarIndiceKario()
+{
+    if (!indiceKario)
+    {
+        desativarIndiceAprendido();
+        indiceKario.reset(new (std::nothrow) IndiceKario());
+    }
+    atualizarIndice();
+}
+
+/**
+ * Desativa o índice k-ário e libera seus nós
+ * Complexidade: O(1)
+ */
+void ListaOrdenada::desativarIndiceKario()
+{
+    if (indiceKario)
+    {
+        indiceKario.reset();
+        indiceValido = false;
+    }
+}
+
+/**
+ * Obtém o número de trechos lineares do índice aprendido
+ * Complexidade: O(1)
+ */
+int ListaOrdenada::getTrechosIndice() const
+{
+    return indiceAprendidoAtivo() && indiceValido ? static_cast<int>(indice.size()) : 0;
+}
+
 /**
  * Remove o primeiro elemento da lista
  * Complexidade: O(n) - Precisa deslocar todos os elementos para a esquerda
  */
 Elemento *ListaOrdenada::removerPrimeiro()
 {
+    consolidar();
     if (estaVazia())
     {
         return nullptr;
@@ -128,13 +708,12 @@ Elemento *ListaOrdenada::removerPrimeiro()
 
     Elemento *elementoRemovido = elementos[0];
 
-    // Desloca todos os elementos para a esquerda
-    for (int i = 0; i < tamanho - 1; i++)
-    {
-        elementos[i] = elementos[i + 1];
-    }
+    // Desloca todos os elementos e IDs para a esquerda
+    std::copy(elementos + 1, elementos + tamanho, elementos);
+    std::copy(ids + 1, ids + tamanho, ids);
 
     tamanho--;
+    registrarAlteracao();
     return elementoRemovido;
 }
 
@@ -144,6 +723,7 @@ Elemento *ListaOrdenada::removerPrimeiro()
  */
 Elemento *ListaOrdenada::removerUltimo()
 {
+    consolidar();
     if (estaVazia())
     {
         return nullptr;
@@ -151,6 +731,7 @@ Elemento *ListaOrdenada::removerUltimo()
 
     Elemento *elementoRemovido = elementos[tamanho - 1];
     tamanho--;
+    registrarAlteracao();
     return elementoRemovido;
 }
 
@@ -160,6 +741,15 @@ Elemento *ListaOrdenada::removerUltimo()
  */
 Elemento *ListaOrdenada::removerPeloId(int id)
 {
+    // O buffer guarda as inserções mais recentes: é consultado primeiro
+    int posicaoBuffer = encontrarNoBuffer(id);
+    if (posicaoBuffer != -1)
+    {
+        Elemento *elementoRemovido = buffer[posicaoBuffer].second;
+        buffer.erase(buffer.begin() + posicaoBuffer);
+        return elementoRemovido;
+    }
+
     int posicao = encontrarPosicaoElemento(id);
 
     if (posicao == -1)
@@ -169,22 +759,74 @@ Elemento *ListaOrdenada::removerPeloId(int id)
 
     Elemento *elementoRemovido = elementos[posicao];
 
-    // Desloca elementos para a esquerda
-    for (int i = posicao; i < tamanho - 1; i++)
-    {
-        elementos[i] = elementos[i + 1];
-    }
+    // Desloca elementos e IDs para a esquerda
+    std::copy(elementos + posicao + 1, elementos + tamanho, elementos + posicao);
+    std::copy(ids + posicao + 1, ids + tamanho, ids + posicao);
 
     tamanho--;
+    registrarAlteracao();
     return elementoRemovido;
 }
 
+/**
+ * Remove todos os elementos que satisfazem o predicado
+ * Cada elemento mantido é copiado uma única vez para a próxima posição livre,
+ * o que preserva a ordenação sem nenhuma comparação de IDs
+ * Complexidade: O(n)
+ */
+int ListaOrdenada::removerSe(const std::function<bool(const Elemento *)> &predicado,
+                             std::vector<Elemento *> *removidos)
+{
+    consolidar();
+
+    int destino = 0;
+    for (int i = 0; i < tamanho; i++)
+    {
+        Elemento *elemento = elementos[i];
+
+        if (predicado(elemento))
+        {
+            if (removidos != nullptr)
+            {
+                removidos->push_back(elemento);
+            }
+            else
+            {
+                delete elemento;
+            }
+            continue;
+        }
+
+        ids[destino] = ids[i];
+        elementos[destino++] = elemento;
+    }
+
+    int quantidadeRemovida = tamanho - destino;
+    tamanho = destino;
+    if (quantidadeRemovida > 0)
+    {
+        // A compactação já custou O(n): o índice é reconstruído em seguida
+        indiceValido = false;
+        atualizarIndice();
+    }
+    return quantidadeRemovida;
+}
+
 /**
  * Busca um elemento pelo ID usando busca binária
  * Complexidade: O(log n) - Busca binária
  */
 Elemento *ListaOrdenada::buscarPeloId(int id) const
 {
+    if (!buffer.empty())
+    {
+        int posicaoBuffer = encontrarNoBuffer(id);
+        if (posicaoBuffer != -1)
+        {
+            return buffer[posicaoBuffer].second;
+        }
+    }
+
     int posicao = encontrarPosicaoElemento(id);
 
     if (posicao != -1)
@@ -195,6 +837,261 @@ Elemento *ListaOrdenada::buscarPeloId(int id) const
     return nullptr;
 }
 
+/**
+ * Busca todos os elementos com ID em [idMin, idMax]
+ * O fim do trecho é o limite inferior de idMax + 1 (ou o fim da lista, se
+ * idMax é o maior int)
+ * Complexidade: O(log n), ou O(n + m) se há inserções pendentes no buffer
+ */
+ListaOrdenada::Intervalo ListaOrdenada::buscarIntervalo(int idMin, int idMax)
+{
+    consolidar();
+
+    Intervalo intervalo;
+    if (idMax < idMin)
+    {
+        intervalo.primeiro = intervalo.ultimo = elementos;
+        return intervalo;
+    }
+
+    int inicioTrecho = encontrarPosicaoInsercao(idMin);
+    int fimTrecho = idMax == std::numeric_limits<int>::max() ? tamanho : encontrarPosicaoInsercao(idMax + 1);
+    intervalo.primeiro = elementos + inicioTrecho;
+    intervalo.ultimo = elementos + fimTrecho;
+    return intervalo;
+}
+
+/**
+ * Obtém o elemento de uma posição
+ * Com inserções pendentes, as posições 0..posicao da lista intercalada são
+ * os "noBuffer" primeiros do buffer mais os posicao + 1 - noBuffer primeiros
+ * do array; noBuffer é achado por busca binária, com o mesmo desempate da
+ * intercalação (um ID repetido do buffer fica antes do que já estava no array)
+ * Complexidade: O(1), ou O(log m) com inserções pendentes no buffer
+ */
+Elemento *ListaOrdenada::obterNaPosicao(int posicao) const
+{
+    if (posicao < 0 || posicao >= getTamanho())
+    {
+        return nullptr;
+    }
+    if (buffer.empty())
+    {
+        return elementos[posicao];
+    }
+
+    int quantidade = posicao + 1;
+    int tamanhoBuffer = static_cast<int>(buffer.size());
+    int minimo = std::max(0, quantidade - tamanho);
+    int maximo = std::min(quantidade, tamanhoBuffer);
+    int noBuffer = minimo;
+    while (minimo <= maximo)
+    {
+        noBuffer = minimo + (maximo - minimo) / 2;
+        int noArray = quantidade - noBuffer;
+        if (noBuffer > 0 && noArray < tamanho && buffer[noBuffer - 1].first > ids[noArray])
+        {
+            maximo = noBuffer - 1; // O último do buffer viria depois de um do array que ficou de fora
+        }
+        else if (noArray > 0 && noBuffer < tamanhoBuffer && ids[noArray - 1] >= buffer[noBuffer].first)
+        {
+            minimo = noBuffer + 1; // O último do array viria depois de um do buffer que ficou de fora
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    int noArray = quantidade - noBuffer;
+    if (noBuffer == 0)
+    {
+        return elementos[noArray - 1];
+    }
+    if (noArray == 0 || buffer[noBuffer - 1].first > ids[noArray - 1])
+    {
+        return buffer[noBuffer - 1].second;
+    }
+    return elementos[noArray - 1];
+}
+
+/**
+ * Conta os elementos com ID menor que o informado
+ * Complexidade: O(log n)
+ */
+int ListaOrdenada::rank(int id) const
+{
+    int menoresNoBuffer = static_cast<int>(
+        std::lower_bound(buffer.begin(), buffer.end(), id,
+                         [](const std::pair<int, Elemento *> &entrada, int chave)
+                         { return entrada.first < chave; }) -
+        buffer.begin());
+
+    return encontrarPosicaoInsercao(id) + menoresNoBuffer;
+}
+
+/**
+ * Obtém o elemento do percentil informado (posto mais próximo)
+ * Complexidade: O(1), ou O(log m) com inserções pendentes no buffer
+ */
+Elemento *ListaOrdenada::percentil(double p) const
+{
+    int total = getTamanho();
+    if (total == 0 || !(p >= 0.0 && p <= 100.0))
+    {
+        return nullptr;
+    }
+
+    int posicao = static_cast<int>(std::ceil(p / 100.0 * total)) - 1;
+    return obterNaPosicao(std::min(std::max(posicao, 0), total - 1));
+}
+
+/**
+ * Obtém o elemento de menor ID
+ * Na intercalação do buffer, um ID repetido do buffer fica antes do que já
+ * estava no array; aqui vale o mesmo desempate
+ * Complexidade: O(1)
+ */
+Elemento *ListaOrdenada::primeiro() const
+{
+    if (!buffer.empty() && (tamanho == 0 || buffer.front().first <= ids[0]))
+    {
+        return buffer.front().second;
+    }
+    return tamanho > 0 ? elementos[0] : nullptr;
+}
+
+/**
+ * Obtém o elemento de maior ID
+ * Complexidade: O(1)
+ */
+Elemento *ListaOrdenada::ultimo() const
+{
+    if (!buffer.empty() && (tamanho == 0 || buffer.back().first > ids[tamanho - 1]))
+    {
+        return buffer.back().second;
+    }
+    return tamanho > 0 ? elementos[tamanho - 1] : nullptr;
+}
+
+/**
+ * Encontra as posições de uma lista cujos IDs aparecem na outra
+ * Complexidade: O(n + m), ou O(m log(n / m)) se uma lista for muito menor
+ */
+std::vector<int> ListaOrdenada::posicoesEmComum(const Consolidada &lista, const Consolidada &outra)
+{
+    std::vector<int> posicoes(lista.tamanho);
+    int quantidade = OperacoesVetoriais::intersecaoOrdenada(lista.ids, lista.tamanho, outra.ids, outra.tamanho,
+                                                           posicoes.data());
+    posicoes.resize(quantidade);
+    return posicoes;
+}
+
+/**
+ * Interseção com outra lista
+ * Complexidade: O(n + m), ou O(m log(n / m)) se uma lista for muito menor
+ */
+int ListaOrdenada::intersecao(const ListaOrdenada &outra, std::vector<Elemento *> *resultado,
+                              std::vector<int> *idsResultado) const
+{
+    Consolidada desta;
+    Consolidada daOutra;
+    obterConsolidada(desta);
+    outra.obterConsolidada(daOutra);
+
+    std::vector<int> posicoes = posicoesEmComum(desta, daOutra);
+    for (int posicao : posicoes)
+    {
+        if (resultado != nullptr)
+        {
+            resultado->push_back(desta.elementos[posicao]);
+        }
+        if (idsResultado != nullptr)
+        {
+            idsResultado->push_back(desta.ids[posicao]);
+        }
+    }
+    return static_cast<int>(posicoes.size());
+}
+
+/**
+ * Diferença com outra lista: o complemento das posições em comum
+ * Complexidade: O(n + m)
+ */
+int ListaOrdenada::diferenca(const ListaOrdenada &outra, std::vector<Elemento *> *resultado,
+                             std::vector<int> *idsResultado) const
+{
+    Consolidada desta;
+    Consolidada daOutra;
+    obterConsolidada(desta);
+    outra.obterConsolidada(daOutra);
+
+    std::vector<int> posicoes = posicoesEmComum(desta, daOutra);
+    size_t proximaComum = 0;
+    for (int i = 0; i < desta.tamanho; i++)
+    {
+        if (proximaComum < posicoes.size() && posicoes[proximaComum] == i)
+        {
+            proximaComum++;
+            continue;
+        }
+        if (resultado != nullptr)
+        {
+            resultado->push_back(desta.elementos[i]);
+        }
+        if (idsResultado != nullptr)
+        {
+            idsResultado->push_back(desta.ids[i]);
+        }
+    }
+    return desta.tamanho - static_cast<int>(posicoes.size());
+}
+
+/**
+ * União com outra lista
+ * Os elementos da outra lista que já aparecem nesta são descartados com a
+ * mesma interseção; o restante é intercalado com esta lista em uma passada
+ * Complexidade: O(n + m)
+ */
+int ListaOrdenada::uniao(const ListaOrdenada &outra, std::vector<Elemento *> *resultado,
+                         std::vector<int> *idsResultado) const
+{
+    Consolidada desta;
+    Consolidada daOutra;
+    obterConsolidada(desta);
+    outra.obterConsolidada(daOutra);
+
+    std::vector<int> repetidas = posicoesEmComum(daOutra, desta);
+    size_t proximaRepetida = 0;
+    int i = 0;
+    int j = 0;
+    int quantidade = 0;
+    while (i < desta.tamanho || j < daOutra.tamanho)
+    {
+        // Pula os elementos da outra lista cujo ID já está nesta
+        if (j < daOutra.tamanho && proximaRepetida < repetidas.size() && repetidas[proximaRepetida] == j)
+        {
+            proximaRepetida++;
+            j++;
+            continue;
+        }
+
+        bool vemDesta = j == daOutra.tamanho || (i < desta.tamanho && desta.ids[i] <= daOutra.ids[j]);
+        Elemento *elemento = vemDesta ? desta.elementos[i] : daOutra.elementos[j];
+        int id = vemDesta ? desta.ids[i++] : daOutra.ids[j++];
+        if (resultado != nullptr)
+        {
+            resultado->push_back(elemento);
+        }
+        if (idsResultado != nullptr)
+        {
+            idsResultado->push_back(id);
+        }
+        quantidade++;
+    }
+    return quantidade;
+}
+
 /**
  * Altera um elemento pelo ID
  * Complexidade: O(n) - Busca O(log n) + possível reorganização O(n)
@@ -205,6 +1102,7 @@ bool ListaOrdenada::alterarPeloId(int id, Elemento *novoElemento)
     {
         return false;
     }
+    consolidar();
 
     // Se o novo elemento tem o mesmo ID, substitui diretamente
     if (novoElemento->getID() == id)
@@ -230,6 +1128,24 @@ bool ListaOrdenada::alterarPeloId(int id, Elemento *novoElemento)
     return false;
 }
 
+/**
+ * Cria um retrato imutável da lista, otimizado para buscas
+ * Complexidade: O(n)
+ */
+ListaOrdenadaCongelada *ListaOrdenada::congelar() const
+{
+    Consolidada visao;
+    obterConsolidada(visao);
+
+    ListaOrdenadaCongelada *retrato = new (std::nothrow) ListaOrdenadaCongelada();
+    if (retrato == nullptr || !retrato->construir(visao.elementos, visao.ids, visao.tamanho))
+    {
+        delete retrato;
+        return nullptr;
+    }
+    return retrato;
+}
+
 /**
  * Imprime todos os elementos da lista
  * Complexidade: O(n) - Percorre todos os elementos
@@ -243,10 +1159,34 @@ void ListaOrdenada::imprimirTodos() const
         return;
     }
 
+    int posicao = 0;
+    paraCada([&posicao](const Elemento *elemento)
+             {
+                 std::cout << "Posição " << posicao++ << ": ";
+                 elemento->imprimirInfo();
+             });
+    std::cout << "Total de elementos: " << getTamanho() << std::endl;
+}
+
+/**
+ * Visita todos os elementos em ordem crescente de ID
+ * Com inserções pendentes, intercala o array e o buffer durante o percurso,
+ * com o desempate de intercalar, sem descarregar o buffer
+ * Complexidade: O(n + m)
+ */
+void ListaOrdenada::paraCada(const std::function<void(const Elemento *)> &visitante) const
+{
+    size_t j = 0;
     for (int i = 0; i < tamanho; i++)
     {
-        std::cout << "Posição " << i << ": ";
-        elementos[i]->imprimirInfo();
+        while (j < buffer.size() && buffer[j].first <= ids[i])
+        {
+            visitante(buffer[j++].second);
+        }
+        visitante(elementos[i]);
+    }
+    for (; j < buffer.size(); j++)
+    {
+        visitante(buffer[j].second);
     }
-    std::cout << "Total de elementos: " << tamanho << std::endl;
 }
@@ -2,41 +2,300 @@
 #define LISTA_ORDENADA_H
 
 #include "Elemento.h"
+#include "IndiceKario.h"
+#include "ListaOrdenadaCongelada.h"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
 
 /**
  * Classe que implementa uma Lista Ordenada com alocação sequencial.
  * Os elementos são mantidos em ordem crescente pelo ID.
+ * O array de ponteiros cresce geometricamente quando fica cheio.
+ * Os IDs são replicados em um array de int paralelo, também ordenado, para que
+ * as buscas binárias comparem apenas chaves contíguas, sem acessar os objetos.
+ * Opcionalmente, um buffer de escrita (como em uma LSM-tree) acumula as
+ * inserções individuais, ordenadas à parte, e as mescla no array principal de
+ * uma só vez quando atinge cerca de √n elementos.
+ * Também opcionalmente, um índice aprendido (modelo linear por partes sobre os
+ * IDs, com erro máximo garantido) prevê a posição de cada ID, e a busca
+ * binária fica restrita a uma pequena janela em torno da previsão. Como
+ * alternativa, um índice k-ário (IndiceKario) com nós do tamanho de uma linha
+ * de cache substitui a busca binária nas listas muito grandes.
+ * Os métodos const não alteram a lista (nem o buffer, nem os índices): sem
+ * nenhuma thread alterando-a, várias podem consultá-la ao mesmo tempo.
  * Demonstra o pilar do Encapsulamento ao esconder os detalhes de implementação.
  */
 class ListaOrdenada
 {
 private:
-    static const int TAMANHO_MAX = 100; // Capacidade máxima da lista
-    Elemento **elementos;               // Array de ponteiros para elementos
-    int tamanho;                        // Número atual de elementos na lista
-    int capacidade;                     // Capacidade máxima da lista
+    static const int CAPACIDADE_INICIAL = 16;       // Capacidade alocada na construção
+    static const int CAPACIDADE_MAXIMA;             // Maior capacidade representável
+    static const int LIMITE_BUFFER_PADRAO = 64;     // Tamanho mínimo do buffer de escrita
+    static const int ERRO_INDICE_PADRAO = 16;       // Erro máximo padrão do índice aprendido (posições)
+    static const int ALTERACOES_MINIMAS_INDICE = 64; // Alterações individuais mínimas entre reconstruções do índice
 
     /**
-     * Encontra a posição correta para inserir um elemento (busca binária)
+     * Trecho do índice aprendido: uma reta que prevê a posição dos IDs em
+     * [primeiraChave, ultimaChave] com erro de no máximo erroIndice posições
+     */
+    struct SegmentoIndice
+    {
+        int primeiraChave;  // Menor ID coberto (prevista exatamente em posicaoInicial)
+        int ultimaChave;    // Maior ID coberto
+        int posicaoInicial; // Posição do primeiro elemento com ID >= primeiraChave
+        double inclinacao;  // Posições por unidade de ID
+    };
+
+    Elemento **elementos;                           // Array de ponteiros para elementos
+    int *ids;                                       // IDs dos elementos, na mesma ordem de elementos
+    int tamanho;                                    // Número de elementos no array (fora do buffer)
+    int capacidade;                                 // Capacidade atual do array
+    double fatorCrescimento;                        // Fator aplicado à capacidade a cada realocação
+    std::vector<std::pair<int, Elemento *>> buffer; // Inserções pendentes (ID, elemento), ordenadas pelo ID
+    int limiteMinimoBuffer;                         // Tamanho mínimo do buffer ao descarregar (0 se desativado)
+    int erroIndice;                                 // Erro máximo do índice aprendido (0 se desativado)
+    std::vector<SegmentoIndice> indice;             // Trechos do índice aprendido, em ordem de primeiraChave
+    std::vector<int> chavesIndice;                  // primeiraChave de cada trecho, contíguas para a busca
+    std::unique_ptr<IndiceKario> indiceKario;       // Índice k-ário (nullptr se desativado)
+    bool indiceValido;                              // Se o índice ativo (aprendido ou k-ário) corresponde ao array
+    int alteracoesPendentes;                        // Alterações individuais desde a última reconstrução do índice
+
+    /**
+     * Realoca os arrays para a capacidade informada, copiando os elementos e IDs
+     * @param novaCapacidade Nova capacidade (deve ser >= tamanho)
+     * @return true se realocado com sucesso, false se faltou memória
+     * Complexidade: O(n) - Copia todos os ponteiros e IDs
+     */
+    bool realocar(int novaCapacidade);
+
+    /**
+     * Calcula a capacidade a alocar para comportar pelo menos "minimo" elementos,
+     * crescendo geometricamente
+     * @param minimo Número de elementos que precisa caber
+     * @return Nova capacidade, ou -1 se excede a capacidade máxima
+     * Complexidade: O(1)
+     */
+    int calcularCrescimento(long long minimo) const;
+
+    /**
+     * Garante espaço para pelo menos "quantidade" elementos além dos atuais
+     * @param quantidade Número de elementos a inserir
+     * @return true se há espaço disponível, false caso contrário
+     * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+     */
+    bool garantirEspacoPara(size_t quantidade);
+
+    /**
+     * Garante espaço para pelo menos mais um elemento
+     * @return true se há espaço disponível, false caso contrário
+     * Complexidade: O(1) amortizado
+     */
+    bool garantirEspaco();
+
+    /**
+     * Limite inferior em um array ordenado de int (busca binária sem desvios)
+     * @param chaves Array ordenado
+     * @param n Número de chaves
+     * @param id Chave procurada
+     * @return Posição da primeira chave >= id (n se todas forem menores)
+     * Complexidade: O(log n)
+     */
+    static int limiteInferior(const int *chaves, int n, int id);
+
+    /**
+     * Encontra a posição correta para inserir um elemento (busca binária sem
+     * desvios no array de IDs)
      * @param id ID do elemento a ser inserido
-     * @return Posição onde o elemento deve ser inserido
+     * @return Posição do primeiro ID >= id (tamanho se todos forem menores)
      * Complexidade: O(log n) - Busca binária
      */
     int encontrarPosicaoInsercao(int id) const;
 
+    /**
+     * Encontra a posição de inserção de um ID usando o índice aprendido
+     * (que deve estar válido): busca binária só na janela em torno da previsão
+     * @param id ID procurado
+     * @return Posição do primeiro ID >= id (tamanho se todos forem menores)
+     * Complexidade: O(log s + log e), com s trechos e erro máximo e
+     */
+    int buscarNoIndice(int id) const;
+
+    /**
+     * Registra uma alteração individual do array (inserção ou remoção fora do
+     * buffer): invalida o índice ativo e o reconstrói quando as alterações
+     * desde a última reconstrução chegam a max(ALTERACOES_MINIMAS_INDICE, √n)
+     * Complexidade: O(√n) amortizado
+     */
+    void registrarAlteracao();
+
     /**
      * Encontra a posição de um elemento pelo ID (busca binária)
      * @param id ID do elemento a ser buscado
-     * @return Posição do elemento ou -1 se não encontrado
+     * @return Posição da primeira ocorrência do ID ou -1 se não encontrado
      * Complexidade: O(log n) - Busca binária
      */
     int encontrarPosicaoElemento(int id) const;
 
+    /**
+     * Encontra a posição de um elemento pelo ID no buffer de escrita (busca binária)
+     * @param id ID do elemento a ser buscado
+     * @return Posição no buffer ou -1 se não encontrado
+     * Complexidade: O(log m), com m o tamanho do buffer
+     */
+    int encontrarNoBuffer(int id) const;
+
+    /**
+     * Intercala no array um lote já ordenado pelo ID, de trás para frente
+     * @param lote Pares (ID, elemento) em ordem crescente de ID
+     * @param n Número de pares
+     * @return true se intercalado, false (sem alterar a lista) se faltou memória
+     * Complexidade: O(n + m)
+     */
+    bool intercalar(const std::pair<int, Elemento *> *lote, size_t n);
+
+    /**
+     * Elementos e IDs da lista como se o buffer de escrita já tivesse sido
+     * descarregado: apontam para o próprio array se o buffer está vazio, ou
+     * para uma cópia intercalada, sem alterar a lista
+     */
+    struct Consolidada
+    {
+        Elemento *const *elementos;             // Elementos em ordem crescente de ID
+        const int *ids;                         // IDs, na mesma ordem
+        int tamanho;                            // Número de elementos
+        std::vector<Elemento *> copiaElementos; // Cópia intercalada (só com inserções pendentes)
+        std::vector<int> copiaIds;              // IDs da cópia intercalada
+    };
+
+    /**
+     * Preenche a visão consolidada da lista sem descarregar o buffer de escrita
+     * @param visao Visão a preencher
+     * Complexidade: O(1), ou O(n + m) se há inserções pendentes no buffer
+     */
+    void obterConsolidada(Consolidada &visao) const;
+
+    /**
+     * Encontra as posições de uma lista cujos IDs aparecem na outra
+     * @param lista Lista cujas posições são devolvidas
+     * @param outra Lista comparada
+     * @return Posições em ordem crescente
+     * Complexidade: O(n + m), ou O(m log(n / m)) se uma lista for muito menor
+     */
+    static std::vector<int> posicoesEmComum(const Consolidada &lista, const Consolidada &outra);
+
+    /**
+     * Insere um elemento no buffer de escrita, descarregando-o se atingiu o limite
+     * @param elemento Ponteiro para o elemento (não nulo)
+     * @return true se inserido com sucesso, false caso contrário
+     * Complexidade: O(√n) amortizado
+     */
+    bool inserirNoBuffer(Elemento *elemento);
+
+    /**
+     * Mescla o buffer de escrita no array principal e o esvazia
+     * Complexidade: O(n + m)
+     */
+    void descarregarBuffer();
+
 public:
+    /**
+     * Iterador constante compatível com a STL: como o array é contíguo e não
+     * circular, um ponteiro para as posições já é um iterador de acesso aleatório
+     */
+    typedef Elemento *const *Iterador;
+
+    /**
+     * Iterador constante compatível com a STL (forward iterator) para percorrer
+     * uma lista const: intercala o array e o buffer de escrita durante o
+     * percurso, como paraCada, sem descarregar o buffer. Um ID repetido do
+     * buffer vem antes do que já estava no array, como na intercalação
+     * Complexidade: O(1) por avanço
+     */
+    class IteradorConstante
+    {
+    private:
+        const ListaOrdenada *lista; // Lista percorrida
+        int posicaoArray;           // Próxima posição do array (tamanho no fim)
+        size_t posicaoBuffer;       // Próxima posição do buffer (buffer.size() no fim)
+
+        IteradorConstante(const ListaOrdenada *lista, int posicaoArray, size_t posicaoBuffer)
+            : lista(lista), posicaoArray(posicaoArray), posicaoBuffer(posicaoBuffer) {}
+        friend class ListaOrdenada;
+
+        /**
+         * Verifica se o elemento atual vem do buffer
+         * Complexidade: O(1)
+         */
+        bool doBuffer() const
+        {
+            return posicaoBuffer < lista->buffer.size() &&
+                   (posicaoArray == lista->tamanho || lista->buffer[posicaoBuffer].first <= lista->ids[posicaoArray]);
+        }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Elemento *value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Elemento *const *pointer;
+        typedef Elemento *const &reference;
+
+        IteradorConstante() : lista(nullptr), posicaoArray(0), posicaoBuffer(0) {}
+        reference operator*() const
+        {
+            return doBuffer() ? lista->buffer[posicaoBuffer].second : lista->elementos[posicaoArray];
+        }
+        pointer operator->() const { return &**this; }
+        IteradorConstante &operator++()
+        {
+            if (doBuffer())
+            {
+                posicaoBuffer++;
+            }
+            else
+            {
+                posicaoArray++;
+            }
+            return *this;
+        }
+        IteradorConstante operator++(int)
+        {
+            IteradorConstante anterior = *this;
+            ++*this;
+            return anterior;
+        }
+        bool operator==(const IteradorConstante &outro) const
+        {
+            return posicaoArray == outro.posicaoArray && posicaoBuffer == outro.posicaoBuffer;
+        }
+        bool operator!=(const IteradorConstante &outro) const { return !(*this == outro); }
+    };
+
+    /**
+     * Visão de um trecho contíguo da lista (sem cópia), como a devolvida por
+     * buscarIntervalo. Pode ser percorrida com for por intervalo e só é válida
+     * enquanto a lista não for alterada
+     */
+    struct Intervalo
+    {
+        Iterador primeiro; // Primeiro elemento do trecho
+        Iterador ultimo;   // Posição depois do último elemento do trecho
+
+        Iterador begin() const { return primeiro; }
+        Iterador end() const { return ultimo; }
+        int getTamanho() const { return static_cast<int>(ultimo - primeiro); }
+        bool estaVazio() const { return primeiro == ultimo; }
+    };
+
     /**
      * Construtor da Lista Ordenada
+     * @param capacidadeInicial Número de posições alocadas inicialmente
+     * @param fatorCrescimento Fator de crescimento da capacidade (deve ser > 1)
      */
-    ListaOrdenada();
+    ListaOrdenada(int capacidadeInicial = CAPACIDADE_INICIAL, double fatorCrescimento = 2.0);
 
     /**
      * Destrutor da Lista Ordenada
@@ -45,20 +304,46 @@ public:
 
     /**
      * Insere um elemento no início da lista (mantém ordem)
+     * Com o buffer de escrita ativo, o elemento vai para o buffer
      * @param elemento Ponteiro para o elemento a ser inserido
      * @return true se inserido com sucesso, false caso contrário
-     * Complexidade: O(n) - Busca O(log n) + inserção O(n)
+     * Complexidade: O(n) - Busca O(log n) + inserção O(n); O(√n) amortizado com buffer
      */
     bool inserirNoInicio(Elemento *elemento);
 
     /**
      * Insere um elemento no final da lista (mantém ordem)
+     * Com o buffer de escrita ativo, o elemento vai para o buffer
      * @param elemento Ponteiro para o elemento a ser inserido
      * @return true se inserido com sucesso, false caso contrário
-     * Complexidade: O(n) - Busca O(log n) + inserção O(n)
+     * Complexidade: O(n) - Busca O(log n) + inserção O(n); O(√n) amortizado com buffer
      */
     bool inserirNoFinal(Elemento *elemento);
 
+    /**
+     * Insere um lote de elementos mantendo a ordem (equivale a mesclar)
+     * @param primeiro Ponteiro para o primeiro ponteiro do lote
+     * @param n Número de elementos do lote
+     * @return true se todos foram inseridos, false (sem inserir nenhum) se algum
+     * ponteiro é nulo ou faltou memória
+     * Complexidade: O(n + m log m), com m o tamanho do lote
+     */
+    bool inserirVarios(Elemento *const *primeiro, size_t n);
+
+    /**
+     * Mescla um lote de elementos na lista, mantendo a ordem
+     * O lote é ordenado pelo ID (a ordenação é dispensada se ele já vier
+     * ordenado) e intercalado de trás para frente no próprio array, já com
+     * espaço para o lote: cada elemento existente é movido no máximo uma vez,
+     * em vez de um deslocamento O(n) por elemento inserido
+     * @param primeiro Ponteiro para o primeiro ponteiro do lote
+     * @param n Número de elementos do lote
+     * @return true se todos foram inseridos, false (sem inserir nenhum) se algum
+     * ponteiro é nulo ou faltou memória
+     * Complexidade: O(n + m) com o lote ordenado, O(n + m log m) caso contrário
+     */
+    bool mesclar(Elemento *const *primeiro, size_t n);
+
     /**
      * Remove o primeiro elemento da lista
      * @return Ponteiro para o elemento removido ou nullptr se vazia
@@ -81,14 +366,122 @@ public:
      */
     Elemento *removerPeloId(int id);
 
+    /**
+     * Remove, em uma única passada, todos os elementos que satisfazem o predicado
+     * @param predicado Função que recebe um elemento e retorna true se ele deve sair
+     * @param removidos Se informado, recebe os elementos removidos (na ordem da lista)
+     * e o chamador passa a ser dono deles; se nullptr, os elementos são liberados
+     * @return Número de elementos removidos
+     * Complexidade: O(n) - Compacta o array (a ordem é preservada)
+     */
+    int removerSe(const std::function<bool(const Elemento *)> &predicado,
+                  std::vector<Elemento *> *removidos = nullptr);
+
     /**
      * Busca um elemento pelo ID usando busca binária
+     * Com elementos no buffer de escrita, ele é consultado primeiro
      * @param id ID do elemento a ser buscado
      * @return Ponteiro para o elemento encontrado ou nullptr se não encontrado
-     * Complexidade: O(log n) - Busca binária
+     * Complexidade: O(log n) - Busca binária (no buffer e no array)
      */
     Elemento *buscarPeloId(int id) const;
 
+    /**
+     * Busca todos os elementos com ID em [idMin, idMax]
+     * Como a lista é ordenada, eles ocupam posições consecutivas: duas buscas
+     * binárias localizam as pontas e o resultado é uma visão do próprio array.
+     * Para isso, descarrega antes o buffer de escrita
+     * @param idMin Menor ID do intervalo
+     * @param idMax Maior ID do intervalo (se idMax < idMin, a visão é vazia)
+     * @return Visão dos elementos do intervalo, em ordem crescente de ID
+     * Complexidade: O(log n), ou O(n + m) se há inserções pendentes no buffer -
+     * O percurso da visão custa O(k)
+     */
+    Intervalo buscarIntervalo(int idMin, int idMax);
+
+    /**
+     * Obtém o elemento de uma posição (o k-ésimo menor ID, a partir de 0)
+     * Com elementos no buffer de escrita, ele é consultado à parte, sem descarregá-lo
+     * @param posicao Posição do elemento
+     * @return Ponteiro para o elemento ou nullptr se a posição é inválida
+     * Complexidade: O(1) - Acesso direto ao array; O(log m) com inserções
+     * pendentes no buffer
+     */
+    Elemento *obterNaPosicao(int posicao) const;
+
+    /**
+     * Conta os elementos com ID menor que o informado, que é também a posição
+     * que um elemento com esse ID ocuparia na lista. Com elementos no buffer de
+     * escrita, ele é consultado à parte, sem descarregá-lo
+     * @param id ID de referência (não precisa estar na lista)
+     * @return Número de elementos com ID < id
+     * Complexidade: O(log n) - Busca binária (no buffer e no array)
+     */
+    int rank(int id) const;
+
+    /**
+     * Obtém o elemento do percentil informado pelo método do posto mais
+     * próximo: o de posição ⌈p/100 · n⌉ - 1 (o primeiro, para p = 0). A mediana
+     * é percentil(50) (a menor das duas centrais, se n é par)
+     * @param p Percentil, entre 0 e 100
+     * @return Ponteiro para o elemento ou nullptr se a lista está vazia ou p é inválido
+     * Complexidade: O(1), ou O(log m) com inserções pendentes no buffer
+     */
+    Elemento *percentil(double p) const;
+
+    /**
+     * Obtém o elemento de menor ID, sem removê-lo nem descarregar o buffer de escrita
+     * @return Ponteiro para o elemento ou nullptr se a lista está vazia
+     * Complexidade: O(1)
+     */
+    Elemento *primeiro() const;
+
+    /**
+     * Obtém o elemento de maior ID, sem removê-lo nem descarregar o buffer de escrita
+     * @return Ponteiro para o elemento ou nullptr se a lista está vazia
+     * Complexidade: O(1)
+     */
+    Elemento *ultimo() const;
+
+    /**
+     * Interseção com outra lista: os elementos desta lista cujo ID aparece na outra
+     * Compara só os arrays de IDs (OperacoesVetoriais::intersecaoOrdenada, com
+     * SIMD ou galope conforme os tamanhos) e não copia nenhum elemento
+     * @param outra Lista comparada
+     * @param resultado Se informado, recebe os elementos (desta lista, que continua
+     * dona deles), em ordem crescente de ID
+     * @param idsResultado Se informado, recebe os IDs desses elementos
+     * @return Número de elementos da interseção
+     * Complexidade: O(n + m), ou O(m log(n / m)) se uma lista for muito menor
+     */
+    int intersecao(const ListaOrdenada &outra, std::vector<Elemento *> *resultado,
+                   std::vector<int> *idsResultado = nullptr) const;
+
+    /**
+     * Diferença com outra lista: os elementos desta lista cujo ID não aparece na outra
+     * @param outra Lista comparada
+     * @param resultado Se informado, recebe os elementos (desta lista, que continua
+     * dona deles), em ordem crescente de ID
+     * @param idsResultado Se informado, recebe os IDs desses elementos
+     * @return Número de elementos da diferença
+     * Complexidade: O(n + m)
+     */
+    int diferenca(const ListaOrdenada &outra, std::vector<Elemento *> *resultado,
+                  std::vector<int> *idsResultado = nullptr) const;
+
+    /**
+     * União com outra lista: todos os elementos desta lista, mais os da outra
+     * cujo ID não aparece nesta, intercalados em ordem crescente de ID
+     * @param outra Lista comparada
+     * @param resultado Se informado, recebe os elementos (cada lista continua
+     * dona dos seus)
+     * @param idsResultado Se informado, recebe os IDs desses elementos
+     * @return Número de elementos da união
+     * Complexidade: O(n + m)
+     */
+    int uniao(const ListaOrdenada &outra, std::vector<Elemento *> *resultado,
+              std::vector<int> *idsResultado = nullptr) const;
+
     /**
      * Altera um elemento pelo ID
      * @param id ID do elemento a ser alterado
@@ -98,32 +491,213 @@ public:
      */
     bool alterarPeloId(int id, Elemento *novoElemento);
 
+    /**
+     * Cria um retrato imutável da lista, otimizado para buscas (layout de Eytzinger)
+     * Indicado para catálogos muito mais consultados que alterados: o retrato
+     * não acompanha alterações posteriores da lista e não é dono dos elementos,
+     * que continuam pertencendo a ela
+     * @return Retrato alocado dinamicamente (o chamador passa a ser dono dele)
+     * ou nullptr se faltou memória
+     * Complexidade: O(n)
+     */
+    ListaOrdenadaCongelada *congelar() const;
+
+    /**
+     * Ativa o buffer de escrita: as inserções individuais passam a ir para um
+     * buffer ordenado à parte, que é mesclado no array principal quando atinge
+     * max(limiteMinimo, √n) elementos. Buscas, remoções pelo ID e as consultas
+     * const leem o buffer à parte; as operações que alteram o array ou devolvem
+     * visões dele (begin/end, buscarIntervalo) o descarregam antes
+     * @param limiteMinimo Tamanho mínimo do buffer ao ser descarregado
+     * Complexidade: O(1)
+     */
+    void ativarBufferEscrita(int limiteMinimo = LIMITE_BUFFER_PADRAO);
+
+    /**
+     * Desativa o buffer de escrita, descarregando os elementos pendentes
+     * Complexidade: O(n + m)
+     */
+    void desativarBufferEscrita();
+
+    /**
+     * Verifica se o buffer de escrita está ativo
+     * @return true se ativo, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool bufferEscritaAtivo() const { return limiteMinimoBuffer > 0; }
+
+    /**
+     * Ativa o índice aprendido: as buscas pelo ID e por intervalo passam a usar
+     * um modelo linear por partes sobre os IDs, que prevê a posição de cada um
+     * com erro de no máximo erroMaximo posições; indicado para IDs quase
+     * sequenciais em listas muito mais consultadas que alteradas.
+     * O modelo é construído aqui e reconstruído de forma preguiçosa, sempre
+     * por uma operação não const: pelas operações em lote (mesclar,
+     * inserirVarios, descarga do buffer, removerSe), que já custam O(n), e
+     * pela inserção ou remoção individual que completar max(64, √n)
+     * alterações desde a última reconstrução. Entre uma alteração individual e
+     * a reconstrução, as buscas são binárias; atualizarIndice() antecipa a
+     * reconstrução. As buscas nunca reconstroem o modelo, e por isso várias
+     * threads podem consultar a lista ao mesmo tempo enquanto ninguém a altera.
+     * Desativa o índice k-ário
+     * @param erroMaximo Erro máximo da previsão, em posições
+     * Complexidade: O(n) - Constrói o modelo
+     */
+    void ativarIndiceAprendido(int erroMaximo = ERRO_INDICE_PADRAO);
+
+    /**
+     * Desativa o índice aprendido e libera o modelo
+     * Complexidade: O(1)
+     */
+    void desativarIndiceAprendido();
+
+    /**
+     * Verifica se o índice aprendido está ativo
+     * @return true se ativo, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool indiceAprendidoAtivo() const { return erroIndice > 0; }
+
+    /**
+     * Ativa o índice k-ário: as buscas pelo ID e por intervalo passam a descer
+     * uma árvore estática com 16 IDs por nó, comparados de uma vez com SIMD
+     * (uma linha de cache por nível); indicado para listas muito grandes e
+     * muito consultadas. Como o índice aprendido, que é desativado, é
+     * construído aqui e reconstruído pelas operações em lote, a cada
+     * max(64, √n) alterações individuais ou por atualizarIndice(), nunca
+     * pelas buscas: entre uma alteração individual e a reconstrução, elas são
+     * binárias, e várias threads podem consultar a lista ao mesmo tempo
+     * enquanto ninguém a altera
+     * Complexidade: O(n) - Constrói o índice
+     */
+    void ativarIndiceKario();
+
+    /**
+     * Desativa o índice k-ário e libera seus nós
+     * Complexidade: O(1)
+     */
+    void desativarIndiceKario();
+
+    /**
+     * Verifica se o índice k-ário está ativo
+     * @return true se ativo, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool indiceKarioAtivo() const { return indiceKario != nullptr; }
+
+    /**
+     * Reconstrói o índice ativo (aprendido ou k-ário) se ele está desatualizado,
+     * sem esperar a próxima operação em lote ou o limite de alterações
+     * individuais (ex.: antes de uma sequência de consultas)
+     * Complexidade: O(n) se precisar reconstruir, O(1) caso contrário
+     */
+    void atualizarIndice();
+
+    /**
+     * Obtém o número de trechos lineares do índice aprendido
+     * @return Número de trechos, ou 0 se o índice está desativado ou desatualizado
+     * Complexidade: O(1)
+     */
+    int getTrechosIndice() const;
+
+    /**
+     * Mescla no array principal as inserções pendentes no buffer de escrita
+     * É chamado automaticamente pelas operações que precisam de todos os
+     * elementos no array (iteradores, intervalos, remoções nas pontas etc.),
+     * nenhuma delas const: os métodos const nunca alteram o array nem o buffer
+     * Complexidade: O(n + m) se há inserções pendentes, O(1) caso contrário
+     */
+    void consolidar();
+
     /**
      * Verifica se a lista está vazia
      * @return true se vazia, false caso contrário
      * Complexidade: O(1)
      */
-    bool estaVazia() const { return tamanho == 0; }
+    bool estaVazia() const { return getTamanho() == 0; }
 
     /**
      * Verifica se a lista está cheia
+     * Como o array cresce sob demanda, só fica cheia ao atingir a capacidade máxima
      * @return true se cheia, false caso contrário
      * Complexidade: O(1)
      */
-    bool estaCheia() const { return tamanho >= capacidade; }
+    bool estaCheia() const { return getTamanho() >= CAPACIDADE_MAXIMA; }
+
+    /**
+     * Reserva espaço para pelo menos n elementos, evitando realocações futuras
+     * @param n Capacidade mínima desejada
+     * @return true se a capacidade foi garantida, false se faltou memória
+     * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+     */
+    bool reservar(int n);
+
+    /**
+     * Reduz a capacidade do array ao número atual de elementos
+     * Complexidade: O(n) - Realoca e copia os ponteiros
+     */
+    void encolher();
+
+    /**
+     * Obtém a capacidade atualmente alocada
+     * @return Número de posições disponíveis sem realocação
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const { return capacidade; }
 
     /**
      * Obtém o tamanho atual da lista
-     * @return Número de elementos na lista
+     * @return Número de elementos na lista (incluindo os do buffer de escrita)
      * Complexidade: O(1)
      */
-    int getTamanho() const { return tamanho; }
+    int getTamanho() const { return tamanho + static_cast<int>(buffer.size()); }
 
     /**
      * Imprime todos os elementos da lista
      * Complexidade: O(n)
      */
     void imprimirTodos() const;
+
+    /**
+     * Visita todos os elementos em ordem crescente de ID, sem cópias nem impressão
+     * @param visitante Função chamada uma vez para cada elemento
+     * Complexidade: O(n)
+     */
+    void paraCada(const std::function<void(const Elemento *)> &visitante) const;
+
+    /**
+     * Iterador para o primeiro elemento (descarrega antes o buffer de escrita;
+     * em uma lista const, begin() const o intercala sem descarregar)
+     * Complexidade: O(1), ou O(n + m) se há inserções pendentes no buffer
+     */
+    Iterador begin()
+    {
+        consolidar();
+        return elementos;
+    }
+
+    /**
+     * Iterador para depois do último elemento (descarrega antes o buffer de escrita)
+     * Complexidade: O(1), ou O(n + m) se há inserções pendentes no buffer
+     */
+    Iterador end()
+    {
+        consolidar();
+        return elementos + tamanho;
+    }
+
+    /**
+     * Iterador constante para o primeiro elemento de uma lista const
+     * O buffer de escrita é intercalado durante o percurso, sem ser descarregado
+     * Complexidade: O(1)
+     */
+    IteradorConstante begin() const { return IteradorConstante(this, 0, 0); }
+
+    /**
+     * Iterador constante para depois do último elemento de uma lista const
+     * Complexidade: O(1)
+     */
+    IteradorConstante end() const { return IteradorConstante(this, tamanho, buffer.size()); }
 };
 
 #endif // LISTA_ORDENADA_H
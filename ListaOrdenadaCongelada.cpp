@@ -0,0 +1,85 @@
+#include "ListaOrdenadaCongelada.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+/**
+ * Construtor de um retrato vazio
+ * Complexidade: O(1)
+ */
+ListaOrdenadaCongelada::ListaOrdenadaCongelada()
+    : chaves(nullptr), tamanho(0)
+{
+}
+
+/**
+ * Monta o layout de Eytzinger a partir de um array ordenado por ID
+ * O array de chaves é alinhado a 64 bytes, para que os 16 descendentes de um
+ * nó quatro níveis abaixo (posições 16k..16k + 15) ocupem uma única linha de cache
+ * Complexidade: O(n)
+ */
+bool ListaOrdenadaCongelada::construir(Elemento *const *ordenados, const int *idsOrdenados, int n)
+{
+    std::size_t posicoes = static_cast<std::size_t>(n) + 1;
+    blocoChaves.reset(new (std::nothrow) int[posicoes + CHAVES_POR_LINHA]);
+    elementos.reset(new (std::nothrow) Elemento *[posicoes]);
+    if (!blocoChaves || !elementos)
+    {
+        return false;
+    }
+
+    std::uintptr_t endereco = reinterpret_cast<std::uintptr_t>(blocoChaves.get());
+    std::uintptr_t alinhado = (endereco + 63) & ~static_cast<std::uintptr_t>(63);
+    chaves = blocoChaves.get() + (alinhado - endereco) / sizeof(int);
+
+    tamanho = n;
+    chaves[0] = 0;
+    elementos[0] = nullptr;
+
+    int proximo = 0;
+    preencher(ordenados, idsOrdenados, proximo, 1);
+    return true;
+}
+
+/**
+ * Preenche a subárvore implícita de raiz k com o percurso em ordem
+ * Complexidade: O(tamanho da subárvore) - Recursão de profundidade O(log n)
+ */
+void ListaOrdenadaCongelada::preencher(Elemento *const *ordenados, const int *idsOrdenados, int &proximo, long long k)
+{
+    if (k > tamanho)
+    {
+        return;
+    }
+
+    preencher(ordenados, idsOrdenados, proximo, 2 * k);
+    chaves[k] = idsOrdenados[proximo];
+    elementos[k] = ordenados[proximo];
+    proximo++;
+    preencher(ordenados, idsOrdenados, proximo, 2 * k + 1);
+}
+
+/**
+ * Busca um elemento pelo ID (limite inferior na árvore implícita)
+ * Cada passo desce para 2k (chave >= id) ou 2k + 1 (chave < id). Ao sair da
+ * árvore, os bits de k registram o caminho: descartando os passos à direita do
+ * final (os 1s menos significativos) e mais um, chega-se ao último nó em que a
+ * busca desceu à esquerda, isto é, à menor chave >= id
+ * Complexidade: O(log n)
+ */
+Elemento *ListaOrdenadaCongelada::buscarPeloId(int id) const
+{
+    std::size_t k = 1;
+    while (k <= static_cast<std::size_t>(tamanho))
+    {
+        __builtin_prefetch(chaves + k * CHAVES_POR_LINHA);
+        k = 2 * k + (chaves[k] < id);
+    }
+    k >>= __builtin_ffsll(static_cast<long long>(~k));
+
+    if (k != 0 && chaves[k] == id)
+    {
+        return elementos[k];
+    }
+    return nullptr;
+}
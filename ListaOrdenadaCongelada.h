@@ -0,0 +1,89 @@
+#ifndef LISTA_ORDENADA_CONGELADA_H
+#define LISTA_ORDENADA_CONGELADA_H
+
+#include "Elemento.h"
+#include <memory>
+
+/**
+ * Classe que representa um retrato imutável de uma ListaOrdenada, otimizado
+ * para buscas (obtido com ListaOrdenada::congelar).
+ * Os IDs ficam em um array de int próprio, no layout de Eytzinger: a posição k
+ * guarda a raiz de uma árvore binária de busca implícita cujos filhos estão em
+ * 2k e 2k + 1 (ordem de uma busca em largura). Assim os primeiros níveis da
+ * busca ficam juntos no início do array e os descendentes de um nó ficam em
+ * posições previsíveis, que podem ser carregadas antecipadamente (prefetch).
+ * Os ponteiros dos elementos ficam em um array paralelo, consultado apenas ao
+ * final da busca.
+ * O retrato não é dono dos elementos: eles pertencem à lista de origem e o
+ * retrato só é válido enquanto esses elementos existirem.
+ * Demonstra o pilar do Encapsulamento ao esconder o layout das chaves.
+ */
+class ListaOrdenadaCongelada
+{
+private:
+    static const int CHAVES_POR_LINHA = 16; // IDs por linha de cache de 64 bytes
+
+    std::unique_ptr<int[]> blocoChaves;        // Memória das chaves (com folga para o alinhamento)
+    int *chaves;                               // Chaves em layout de Eytzinger, posições 1..tamanho
+    std::unique_ptr<Elemento *[]> elementos;   // Elemento de cada posição de chaves
+    int tamanho;                               // Número de elementos
+
+    /**
+     * Construtor de um retrato vazio (use ListaOrdenada::congelar)
+     */
+    ListaOrdenadaCongelada();
+
+    /**
+     * Monta o layout de Eytzinger a partir de um array ordenado por ID
+     * @param ordenados Elementos em ordem crescente de ID
+     * @param idsOrdenados IDs dos elementos, na mesma ordem
+     * @param n Número de elementos
+     * @return true se montado com sucesso, false se faltou memória
+     * Complexidade: O(n)
+     */
+    bool construir(Elemento *const *ordenados, const int *idsOrdenados, int n);
+
+    /**
+     * Preenche a subárvore implícita de raiz k com o percurso em ordem do array ordenado
+     * @param ordenados Elementos em ordem crescente de ID
+     * @param idsOrdenados IDs dos elementos, na mesma ordem
+     * @param proximo Próxima posição de ordenados a ser consumida
+     * @param k Raiz da subárvore (1 <= k)
+     * Complexidade: O(tamanho da subárvore)
+     */
+    void preencher(Elemento *const *ordenados, const int *idsOrdenados, int &proximo, long long k);
+
+    friend class ListaOrdenada;
+
+public:
+    ListaOrdenadaCongelada(const ListaOrdenadaCongelada &) = delete;
+    ListaOrdenadaCongelada &operator=(const ListaOrdenadaCongelada &) = delete;
+
+    /**
+     * Busca um elemento pelo ID
+     * Desce a árvore implícita sem desvios condicionais (o próximo nó é 2k ou
+     * 2k + 1 conforme a comparação) e carrega antecipadamente a linha de cache
+     * dos descendentes quatro níveis abaixo. Com IDs repetidos, retorna o
+     * primeiro deles na ordem da lista
+     * @param id ID do elemento a ser buscado
+     * @return Ponteiro para o elemento encontrado ou nullptr se não encontrado
+     * Complexidade: O(log n)
+     */
+    Elemento *buscarPeloId(int id) const;
+
+    /**
+     * Verifica se o retrato está vazio
+     * @return true se vazio, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool estaVazia() const { return tamanho == 0; }
+
+    /**
+     * Obtém o número de elementos do retrato
+     * @return Número de elementos
+     * Complexidade: O(1)
+     */
+    int getTamanho() const { return tamanho; }
+};
+
+#endif // LISTA_ORDENADA_CONGELADA_H
@@ -0,0 +1,647 @@
+#include "ListaOrdenadaEsparsa.h"
+#include <algorithm>
+#include <iostream>
+#include <new>
+
+const double ListaOrdenadaEsparsa::DENSIDADE_MAXIMA_FOLHA = 1.0;
+const double ListaOrdenadaEsparsa::DENSIDADE_MAXIMA_RAIZ = 0.75;
+const double ListaOrdenadaEsparsa::DENSIDADE_MINIMA_FOLHA = 0.125;
+const double ListaOrdenadaEsparsa::DENSIDADE_MINIMA_RAIZ = 0.25;
+
+namespace
+{
+    /**
+     * Menor potência de 2 com pelo menos o dobro de posições que "quantidade"
+     * (densidade entre 1/4 e 1/2 logo após uma reconstrução)
+     * @return Capacidade (potência de 2 >= minima)
+     * Complexidade: O(log n)
+     */
+    long long capacidadePara(long long quantidade, long long minima)
+    {
+        long long capacidade = minima;
+        while (capacidade < 2 * quantidade)
+        {
+            capacidade *= 2;
+        }
+        return capacidade;
+    }
+
+    /**
+     * Compara pares (ID, elemento) apenas pelo ID
+     */
+    bool menorId(const std::pair<int, Elemento *> &a, const std::pair<int, Elemento *> &b)
+    {
+        return a.first < b.first;
+    }
+}
+
+/**
+ * Construtor da Lista Ordenada Esparsa
+ * Começa com um único segmento de CAPACIDADE_MINIMA posições
+ * Complexidade: O(1)
+ */
+ListaOrdenadaEsparsa::ListaOrdenadaEsparsa()
+    : capacidade(CAPACIDADE_MINIMA),
+      tamanhoSegmento(CAPACIDADE_MINIMA),
+      numeroSegmentos(1),
+      altura(0),
+      tamanho(0)
+{
+    elementos = new Elemento *[capacidade]();
+    ids = new int[capacidade];
+    ocupados = new int[numeroSegmentos]();
+}
+
+/**
+ * Destrutor da Lista Ordenada Esparsa
+ * Complexidade: O(capacidade) - Deleta todos os elementos
+ */
+ListaOrdenadaEsparsa::~ListaOrdenadaEsparsa()
+{
+    for (int segmento = 0; segmento < numeroSegmentos; segmento++)
+    {
+        for (int i = 0; i < ocupados[segmento]; i++)
+        {
+            delete elementos[segmento * tamanhoSegmento + i];
+        }
+    }
+    delete[] elementos;
+    delete[] ids;
+    delete[] ocupados;
+}
+
+/**
+ * Limite superior de densidade de uma janela do nível informado
+ * Complexidade: O(1)
+ */
+double ListaOrdenadaEsparsa::densidadeMaxima(int nivel) const
+{
+    if (altura == 0)
+    {
+        return DENSIDADE_MAXIMA_FOLHA;
+    }
+    return DENSIDADE_MAXIMA_FOLHA - (DENSIDADE_MAXIMA_FOLHA - DENSIDADE_MAXIMA_RAIZ) * nivel / altura;
+}
+
+/**
+ * Limite inferior de densidade de uma janela do nível informado
+ * Complexidade: O(1)
+ */
+double ListaOrdenadaEsparsa::densidadeMinima(int nivel) const
+{
+    if (altura == 0)
+    {
+        return 0.0;
+    }
+    return DENSIDADE_MINIMA_FOLHA + (DENSIDADE_MINIMA_RAIZ - DENSIDADE_MINIMA_FOLHA) * nivel / altura;
+}
+
+/**
+ * Encontra o segmento em que um ID deve ser inserido ou procurado
+ * Busca binária sobre o primeiro ID de cada segmento. Os rebalanceamentos não
+ * deixam segmentos vazios no meio da lista; se algum estiver (por falta de
+ * memória ao rebalancear), a busca recua até o vizinho não vazio à esquerda
+ * Complexidade: O(log n)
+ */
+int ListaOrdenadaEsparsa::encontrarSegmento(int id) const
+{
+    int esquerda = 0;
+    int direita = numeroSegmentos - 1;
+    int resposta = -1;
+
+    while (esquerda <= direita)
+    {
+        int meio = esquerda + (direita - esquerda) / 2;
+        int naoVazio = meio;
+        while (naoVazio >= esquerda && ocupados[naoVazio] == 0)
+        {
+            naoVazio--;
+        }
+
+        if (naoVazio >= esquerda && ids[naoVazio * tamanhoSegmento] < id)
+        {
+            resposta = naoVazio;
+            esquerda = meio + 1;
+        }
+        else
+        {
+            direita = (naoVazio >= esquerda ? naoVazio : meio) - 1;
+        }
+    }
+
+    if (resposta != -1)
+    {
+        return resposta;
+    }
+
+    // Todos os IDs são >= id: o destino é o primeiro segmento não vazio
+    int primeiro = 0;
+    while (primeiro < numeroSegmentos - 1 && ocupados[primeiro] == 0)
+    {
+        primeiro++;
+    }
+    return primeiro;
+}
+
+/**
+ * Encontra, dentro de um segmento, a posição do primeiro ID >= id
+ * Complexidade: O(log tamanhoSegmento)
+ */
+int ListaOrdenadaEsparsa::encontrarNoSegmento(int segmento, int id) const
+{
+    const int *inicio = ids + segmento * tamanhoSegmento;
+    return static_cast<int>(std::lower_bound(inicio, inicio + ocupados[segmento], id) - inicio);
+}
+
+/**
+ * Localiza a primeira ocorrência de um ID
+ * Se todos os IDs do segmento encontrado forem menores, o candidato é o
+ * primeiro elemento do próximo segmento não vazio
+ * Complexidade: O(log n)
+ */
+bool ListaOrdenadaEsparsa::localizar(int id, int &segmento, int &deslocamento) const
+{
+    if (estaVazia())
+    {
+        return false;
+    }
+
+    segmento = encontrarSegmento(id);
+    deslocamento = encontrarNoSegmento(segmento, id);
+    if (deslocamento == ocupados[segmento])
+    {
+        do
+        {
+            segmento++;
+        } while (segmento < numeroSegmentos && ocupados[segmento] == 0);
+        deslocamento = 0;
+    }
+
+    return segmento < numeroSegmentos && ids[segmento * tamanhoSegmento + deslocamento] == id;
+}
+
+/**
+ * Copia os elementos de uma janela de segmentos, em ordem
+ * Complexidade: O(quantidade * tamanhoSegmento)
+ */
+void ListaOrdenadaEsparsa::coletar(int primeiro, int quantidade,
+                                   std::vector<std::pair<int, Elemento *>> &destino) const
+{
+    for (int segmento = primeiro; segmento < primeiro + quantidade; segmento++)
+    {
+        int base = segmento * tamanhoSegmento;
+        for (int i = 0; i < ocupados[segmento]; i++)
+        {
+            destino.push_back(std::make_pair(ids[base + i], elementos[base + i]));
+        }
+    }
+}
+
+/**
+ * Distribui por igual os itens em uma janela de segmentos
+ * Cada segmento recebe n / quantidade itens (os primeiros, um a mais, se a
+ * divisão não for exata), juntos no início; o restante vira lacuna
+ * Complexidade: O(quantidade * tamanhoSegmento)
+ */
+void ListaOrdenadaEsparsa::distribuir(int primeiro, int quantidade,
+                                      const std::vector<std::pair<int, Elemento *>> &itens)
+{
+    int n = static_cast<int>(itens.size());
+    int porSegmento = n / quantidade;
+    int sobra = n % quantidade;
+    int proximo = 0;
+
+    for (int k = 0; k < quantidade; k++)
+    {
+        int segmento = primeiro + k;
+        int base = segmento * tamanhoSegmento;
+        int quantos = porSegmento + (k < sobra ? 1 : 0);
+        for (int i = 0; i < quantos; i++)
+        {
+            ids[base + i] = itens[proximo].first;
+            elementos[base + i] = itens[proximo++].second;
+        }
+        std::fill(elementos + base + quantos, elementos + base + tamanhoSegmento, nullptr);
+        ocupados[segmento] = quantos;
+    }
+}
+
+/**
+ * Realoca o array com a nova capacidade e distribui os itens por igual
+ * O tamanho do segmento é a menor potência de 2 >= log2(capacidade)
+ * Complexidade: O(capacidade)
+ */
+bool ListaOrdenadaEsparsa::reconstruir(int novaCapacidade,
+                                       const std::vector<std::pair<int, Elemento *>> &itens)
+{
+    int bits = 0;
+    while ((1 << bits) < novaCapacidade)
+    {
+        bits++;
+    }
+    int novoTamanhoSegmento = CAPACIDADE_MINIMA;
+    while (novoTamanhoSegmento < bits)
+    {
+        novoTamanhoSegmento *= 2;
+    }
+    int novoNumeroSegmentos = novaCapacidade / novoTamanhoSegmento;
+
+    Elemento **novosElementos = new (std::nothrow) Elemento *[novaCapacidade];
+    int *novosIds = new (std::nothrow) int[novaCapacidade];
+    int *novosOcupados = new (std::nothrow) int[novoNumeroSegmentos];
+    if (novosElementos == nullptr || novosIds == nullptr || novosOcupados == nullptr)
+    {
+        delete[] novosElementos;
+        delete[] novosIds;
+        delete[] novosOcupados;
+        return false;
+    }
+
+    delete[] elementos;
+    delete[] ids;
+    delete[] ocupados;
+    elementos = novosElementos;
+    ids = novosIds;
+    ocupados = novosOcupados;
+    capacidade = novaCapacidade;
+    tamanhoSegmento = novoTamanhoSegmento;
+    numeroSegmentos = novoNumeroSegmentos;
+    altura = 0;
+    while ((1 << altura) < numeroSegmentos)
+    {
+        altura++;
+    }
+
+    distribuir(0, numeroSegmentos, itens);
+    tamanho = static_cast<int>(itens.size());
+    return true;
+}
+
+/**
+ * Insere um elemento mantendo a ordem (implementação para inserirNoInicio)
+ * Se o segmento de destino tem lacuna, só os elementos dele se deslocam.
+ * Se está cheio, sobe-se na árvore até a menor janela que comporta mais um
+ * elemento dentro do limite de densidade do seu nível, e a janela é
+ * redistribuída com o novo elemento; se nem a raiz comporta, a capacidade dobra
+ * Complexidade: O(log² n) amortizado
+ */
+bool ListaOrdenadaEsparsa::inserirNoInicio(Elemento *elemento)
+{
+    if (elemento == nullptr)
+    {
+        return false;
+    }
+
+    int id = elemento->getID();
+    int segmento = encontrarSegmento(id);
+
+    if (ocupados[segmento] < tamanhoSegmento)
+    {
+        int base = segmento * tamanhoSegmento;
+        int posicao = base + encontrarNoSegmento(segmento, id);
+        int fim = base + ocupados[segmento];
+        std::copy_backward(elementos + posicao, elementos + fim, elementos + fim + 1);
+        std::copy_backward(ids + posicao, ids + fim, ids + fim + 1);
+        elementos[posicao] = elemento;
+        ids[posicao] = id;
+        ocupados[segmento]++;
+        tamanho++;
+        return true;
+    }
+
+    std::vector<std::pair<int, Elemento *>> itens;
+    std::pair<int, Elemento *> novo = std::make_pair(id, elemento);
+
+    for (int nivel = 1; nivel <= altura; nivel++)
+    {
+        int largura = 1 << nivel;
+        int primeiro = segmento & ~(largura - 1);
+        long long contagem = 1;
+        for (int k = primeiro; k < primeiro + largura; k++)
+        {
+            contagem += ocupados[k];
+        }
+
+        if (contagem <= densidadeMaxima(nivel) * largura * tamanhoSegmento)
+        {
+            coletar(primeiro, largura, itens);
+            itens.insert(std::lower_bound(itens.begin(), itens.end(), novo, menorId), novo);
+            distribuir(primeiro, largura, itens);
+            tamanho++;
+            return true;
+        }
+    }
+
+    // Nem a raiz comporta o elemento: dobra a capacidade
+    if (capacidade > (1 << 29))
+    {
+        return false;
+    }
+    coletar(0, numeroSegmentos, itens);
+    itens.insert(std::lower_bound(itens.begin(), itens.end(), novo, menorId), novo);
+    return reconstruir(capacidade * 2, itens);
+}
+
+/**
+ * Insere um elemento mantendo a ordem (implementação para inserirNoFinal)
+ * Complexidade: O(log² n) amortizado
+ */
+bool ListaOrdenadaEsparsa::inserirNoFinal(Elemento *elemento)
+{
+    // Como na ListaOrdenada, a posição é determinada pelo ID
+    return inserirNoInicio(elemento);
+}
+
+/**
+ * Insere um lote de elementos mantendo a ordem
+ * Em caso de empate de IDs, o elemento do lote fica antes do existente
+ * Complexidade: O(n + m log m)
+ */
+bool ListaOrdenadaEsparsa::inserirVarios(Elemento *const *primeiro, size_t n)
+{
+    if (n == 0)
+    {
+        return true;
+    }
+    if (primeiro == nullptr || n > static_cast<size_t>(1 << 29) - static_cast<size_t>(tamanho))
+    {
+        return false;
+    }
+
+    std::vector<std::pair<int, Elemento *>> lote;
+    lote.reserve(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        if (primeiro[i] == nullptr)
+        {
+            return false;
+        }
+        lote.push_back(std::make_pair(primeiro[i]->getID(), primeiro[i]));
+    }
+    std::stable_sort(lote.begin(), lote.end(), menorId);
+
+    std::vector<std::pair<int, Elemento *>> existentes;
+    existentes.reserve(tamanho);
+    coletar(0, numeroSegmentos, existentes);
+
+    std::vector<std::pair<int, Elemento *>> itens(lote.size() + existentes.size());
+    std::merge(lote.begin(), lote.end(), existentes.begin(), existentes.end(), itens.begin(), menorId);
+
+    return reconstruir(static_cast<int>(capacidadePara(static_cast<long long>(itens.size()), CAPACIDADE_MINIMA)), itens);
+}
+
+/**
+ * Rebalanceia a vizinhança de um segmento após uma remoção
+ * Se a lista inteira ficou abaixo da densidade mínima da raiz, o array é
+ * reconstruído com metade (ou menos) das posições. Senão, se o segmento ficou
+ * abaixo da densidade mínima da folha, sobe-se na árvore até uma janela acima
+ * do limite do seu nível, que é redistribuída
+ * Complexidade: O(log² n) amortizado
+ */
+void ListaOrdenadaEsparsa::rebalancearAposRemocao(int segmento)
+{
+    if (altura == 0)
+    {
+        return;
+    }
+
+    std::vector<std::pair<int, Elemento *>> itens;
+
+    if (tamanho < densidadeMinima(altura) * capacidade)
+    {
+        itens.reserve(tamanho);
+        coletar(0, numeroSegmentos, itens);
+        // Em caso de falta de memória, mantém o array atual
+        reconstruir(static_cast<int>(capacidadePara(tamanho, CAPACIDADE_MINIMA)), itens);
+        return;
+    }
+
+    if (ocupados[segmento] >= densidadeMinima(0) * tamanhoSegmento)
+    {
+        return;
+    }
+
+    for (int nivel = 1; nivel <= altura; nivel++)
+    {
+        int largura = 1 << nivel;
+        int primeiro = segmento & ~(largura - 1);
+        long long contagem = 0;
+        for (int k = primeiro; k < primeiro + largura; k++)
+        {
+            contagem += ocupados[k];
+        }
+
+        if (contagem >= densidadeMinima(nivel) * largura * tamanhoSegmento)
+        {
+            coletar(primeiro, largura, itens);
+            distribuir(primeiro, largura, itens);
+            return;
+        }
+    }
+}
+
+/**
+ * Remove o elemento de uma posição de um segmento
+ * Complexidade: O(log² n) amortizado
+ */
+Elemento *ListaOrdenadaEsparsa::removerNaPosicao(int segmento, int deslocamento)
+{
+    int base = segmento * tamanhoSegmento;
+    int posicao = base + deslocamento;
+    int fim = base + ocupados[segmento];
+    Elemento *elementoRemovido = elementos[posicao];
+
+    std::copy(elementos + posicao + 1, elementos + fim, elementos + posicao);
+    std::copy(ids + posicao + 1, ids + fim, ids + posicao);
+    elementos[fim - 1] = nullptr;
+    ocupados[segmento]--;
+    tamanho--;
+
+    rebalancearAposRemocao(segmento);
+    return elementoRemovido;
+}
+
+/**
+ * Remove o primeiro elemento da lista
+ * Complexidade: O(log² n) amortizado
+ */
+Elemento *ListaOrdenadaEsparsa::removerPrimeiro()
+{
+    if (estaVazia())
+    {
+        return nullptr;
+    }
+
+    int segmento = 0;
+    while (ocupados[segmento] == 0)
+    {
+        segmento++;
+    }
+    return removerNaPosicao(segmento, 0);
+}
+
+/**
+ * Remove o último elemento da lista
+ * Complexidade: O(log² n) amortizado
+ */
+Elemento *ListaOrdenadaEsparsa::removerUltimo()
+{
+    if (estaVazia())
+    {
+        return nullptr;
+    }
+
+    int segmento = numeroSegmentos - 1;
+    while (ocupados[segmento] == 0)
+    {
+        segmento--;
+    }
+    return removerNaPosicao(segmento, ocupados[segmento] - 1);
+}
+
+/**
+ * Remove um elemento pelo ID
+ * Complexidade: O(log² n) amortizado
+ */
+Elemento *ListaOrdenadaEsparsa::removerPeloId(int id)
+{
+    int segmento, deslocamento;
+    if (!localizar(id, segmento, deslocamento))
+    {
+        return nullptr; // Elemento não encontrado
+    }
+    return removerNaPosicao(segmento, deslocamento);
+}
+
+/**
+ * Remove todos os elementos que satisfazem o predicado
+ * Os elementos mantidos são coletados em ordem e o array é reconstruído uma vez
+ * Complexidade: O(n)
+ */
+int ListaOrdenadaEsparsa::removerSe(const std::function<bool(const Elemento *)> &predicado,
+                                   std::vector<Elemento *> *removidos)
+{
+    std::vector<std::pair<int, Elemento *>> mantidos;
+    mantidos.reserve(tamanho);
+    int quantidadeRemovida = 0;
+
+    for (int segmento = 0; segmento < numeroSegmentos; segmento++)
+    {
+        int base = segmento * tamanhoSegmento;
+        for (int i = 0; i < ocupados[segmento]; i++)
+        {
+            Elemento *elemento = elementos[base + i];
+            if (!predicado(elemento))
+            {
+                mantidos.push_back(std::make_pair(ids[base + i], elemento));
+                continue;
+            }
+
+            if (removidos != nullptr)
+            {
+                removidos->push_back(elemento);
+            }
+            else
+            {
+                delete elemento;
+            }
+            quantidadeRemovida++;
+        }
+    }
+
+    if (quantidadeRemovida > 0 &&
+        !reconstruir(static_cast<int>(capacidadePara(static_cast<long long>(mantidos.size()), CAPACIDADE_MINIMA)), mantidos))
+    {
+        // Sem memória para encolher: redistribui no próprio array
+        distribuir(0, numeroSegmentos, mantidos);
+        tamanho = static_cast<int>(mantidos.size());
+    }
+    return quantidadeRemovida;
+}
+
+/**
+ * Busca um elemento pelo ID
+ * Complexidade: O(log n)
+ */
+Elemento *ListaOrdenadaEsparsa::buscarPeloId(int id) const
+{
+    int segmento, deslocamento;
+    if (!localizar(id, segmento, deslocamento))
+    {
+        return nullptr;
+    }
+    return elementos[segmento * tamanhoSegmento + deslocamento];
+}
+
+/**
+ * Altera um elemento pelo ID
+ * Com o mesmo ID, substitui no lugar; com outro ID, remove e insere
+ * Complexidade: O(log² n) amortizado
+ */
+bool ListaOrdenadaEsparsa::alterarPeloId(int id, Elemento *novoElemento)
+{
+    if (novoElemento == nullptr)
+    {
+        return false;
+    }
+
+    if (novoElemento->getID() == id)
+    {
+        int segmento, deslocamento;
+        if (!localizar(id, segmento, deslocamento))
+        {
+            return false;
+        }
+        int posicao = segmento * tamanhoSegmento + deslocamento;
+        delete elementos[posicao];
+        elementos[posicao] = novoElemento;
+        return true;
+    }
+
+    Elemento *elementoRemovido = removerPeloId(id);
+    if (elementoRemovido != nullptr)
+    {
+        delete elementoRemovido;
+        return inserirNoInicio(novoElemento);
+    }
+    return false;
+}
+
+/**
+ * Imprime todos os elementos da lista
+ * Complexidade: O(capacidade) - Percorre todos os segmentos
+ */
+void ListaOrdenadaEsparsa::imprimirTodos() const
+{
+    std::cout << "=== Lista Ordenada Esparsa (PMA) ===" << std::endl;
+    if (estaVazia())
+    {
+        std::cout << "Lista vazia!" << std::endl;
+        return;
+    }
+
+    int posicao = 0;
+    for (Elemento *elemento : *this)
+    {
+        std::cout << "Posição " << posicao++ << ": ";
+        elemento->imprimirInfo();
+    }
+    std::cout << "Total de elementos: " << tamanho << " (" << capacidade << " posições, "
+              << numeroSegmentos << " segmentos de " << tamanhoSegmento << ")" << std::endl;
+}
+
+/**
+ * Visita todos os elementos em ordem crescente de ID
+ * Complexidade: O(capacidade)
+ */
+void ListaOrdenadaEsparsa::paraCada(const std::function<void(const Elemento *)> &visitante) const
+{
+    for (int segmento = 0; segmento < numeroSegmentos; segmento++)
+    {
+        int base = segmento * tamanhoSegmento;
+        for (int i = 0; i < ocupados[segmento]; i++)
+        {
+            visitante(elementos[base + i]);
+        }
+    }
+}
@@ -0,0 +1,330 @@
+#ifndef LISTA_ORDENADA_ESPARSA_H
+#define LISTA_ORDENADA_ESPARSA_H
+
+#include "Elemento.h"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * Classe que implementa uma Lista Ordenada sobre um Packed Memory Array (PMA):
+ * um array ordenado com lacunas deliberadas, espalhadas entre os elementos.
+ * O array é dividido em segmentos de ~log n posições; em cada segmento os
+ * elementos ficam juntos no início e as lacunas no final. Os segmentos formam
+ * as folhas de uma árvore implícita, e cada nível da árvore tem limites de
+ * densidade (ocupação mínima e máxima). Quando uma inserção encontra o segmento
+ * cheio, ou uma remoção o deixa vazio demais, sobe-se na árvore até uma janela
+ * de segmentos dentro dos limites e só ela é redistribuída por igual.
+ * Assim inserções e remoções movem O(log² n) elementos amortizados, em vez
+ * dos O(n) deslocamentos da ListaOrdenada, e a busca binária e os percursos
+ * continuam sobre memória contígua.
+ * Como na ListaOrdenada, os IDs são replicados em um array de int paralelo.
+ * Demonstra o pilar do Encapsulamento ao esconder as lacunas de quem usa a lista.
+ */
+class ListaOrdenadaEsparsa
+{
+private:
+    static const int CAPACIDADE_MINIMA = 8;     // Capacidade (e tamanho de segmento) mínima
+    static const double DENSIDADE_MAXIMA_FOLHA; // Ocupação máxima de um segmento
+    static const double DENSIDADE_MAXIMA_RAIZ;  // Ocupação máxima do array inteiro
+    static const double DENSIDADE_MINIMA_FOLHA; // Ocupação mínima de um segmento
+    static const double DENSIDADE_MINIMA_RAIZ;  // Ocupação mínima do array inteiro
+
+    Elemento **elementos;  // Posições do array (nullptr nas lacunas)
+    int *ids;              // IDs dos elementos, nas mesmas posições de elementos
+    int *ocupados;         // Número de elementos de cada segmento
+    int capacidade;        // Número de posições do array (potência de 2)
+    int tamanhoSegmento;   // Posições por segmento (potência de 2)
+    int numeroSegmentos;   // capacidade / tamanhoSegmento (potência de 2)
+    int altura;            // log2(numeroSegmentos): nível da raiz na árvore implícita
+    int tamanho;           // Número atual de elementos na lista
+
+    /**
+     * Limite superior de densidade de uma janela do nível informado
+     * Interpolado entre a folha (nível 0) e a raiz (nível altura)
+     * @param nivel Nível da janela (0 = um segmento)
+     * @return Fração máxima de posições ocupadas
+     * Complexidade: O(1)
+     */
+    double densidadeMaxima(int nivel) const;
+
+    /**
+     * Limite inferior de densidade de uma janela do nível informado
+     * @param nivel Nível da janela (0 = um segmento)
+     * @return Fração mínima de posições ocupadas
+     * Complexidade: O(1)
+     */
+    double densidadeMinima(int nivel) const;
+
+    /**
+     * Encontra o segmento em que um ID deve ser inserido ou procurado:
+     * o último não vazio cujo primeiro ID é menor que id (ou o primeiro não vazio)
+     * @param id ID procurado
+     * @return Índice do segmento
+     * Complexidade: O(log n) - Busca binária sobre os segmentos
+     */
+    int encontrarSegmento(int id) const;
+
+    /**
+     * Encontra, dentro de um segmento, a posição do primeiro ID >= id
+     * @param segmento Índice do segmento
+     * @param id ID procurado
+     * @return Deslocamento dentro do segmento (ocupados[segmento] se todos forem menores)
+     * Complexidade: O(log log n)
+     */
+    int encontrarNoSegmento(int segmento, int id) const;
+
+    /**
+     * Localiza a primeira ocorrência de um ID
+     * @param id ID procurado
+     * @param segmento Recebe o índice do segmento
+     * @param deslocamento Recebe a posição dentro do segmento
+     * @return true se encontrado, false caso contrário
+     * Complexidade: O(log n)
+     */
+    bool localizar(int id, int &segmento, int &deslocamento) const;
+
+    /**
+     * Copia os elementos dos segmentos [primeiro, primeiro + quantidade), em ordem
+     * @param primeiro Primeiro segmento
+     * @param quantidade Número de segmentos
+     * @param destino Recebe os pares (ID, elemento)
+     * Complexidade: O(quantidade * tamanhoSegmento)
+     */
+    void coletar(int primeiro, int quantidade, std::vector<std::pair<int, Elemento *>> &destino) const;
+
+    /**
+     * Distribui por igual os itens nos segmentos [primeiro, primeiro + quantidade)
+     * @param primeiro Primeiro segmento
+     * @param quantidade Número de segmentos
+     * @param itens Pares (ID, elemento) em ordem crescente de ID
+     * Complexidade: O(quantidade * tamanhoSegmento)
+     */
+    void distribuir(int primeiro, int quantidade, const std::vector<std::pair<int, Elemento *>> &itens);
+
+    /**
+     * Realoca o array com a nova capacidade e distribui os itens por igual
+     * @param novaCapacidade Número de posições (potência de 2 >= CAPACIDADE_MINIMA)
+     * @param itens Todos os elementos da lista, em ordem crescente de ID
+     * @return true se reconstruído, false (sem alterar a lista) se faltou memória
+     * Complexidade: O(capacidade)
+     */
+    bool reconstruir(int novaCapacidade, const std::vector<std::pair<int, Elemento *>> &itens);
+
+    /**
+     * Rebalanceia a vizinhança de um segmento que ficou vazio demais após uma
+     * remoção, ou encolhe o array se a lista inteira ficou esparsa demais
+     * @param segmento Segmento em que houve a remoção
+     * Complexidade: O(log² n) amortizado
+     */
+    void rebalancearAposRemocao(int segmento);
+
+    /**
+     * Remove o elemento de uma posição de um segmento
+     * @param segmento Índice do segmento
+     * @param deslocamento Posição dentro do segmento
+     * @return Elemento removido
+     * Complexidade: O(log² n) amortizado
+     */
+    Elemento *removerNaPosicao(int segmento, int deslocamento);
+
+public:
+    /**
+     * Iterador constante compatível com a STL (forward iterator), que percorre
+     * os elementos em ordem crescente de ID saltando as lacunas
+     * Complexidade: O(1) amortizado por avanço
+     */
+    class Iterador
+    {
+    private:
+        const ListaOrdenadaEsparsa *lista; // Lista percorrida
+        int segmento;                      // Segmento atual (numeroSegmentos no fim)
+        int deslocamento;                  // Posição dentro do segmento
+
+        Iterador(const ListaOrdenadaEsparsa *lista, int segmento, int deslocamento)
+            : lista(lista), segmento(segmento), deslocamento(deslocamento) {}
+        friend class ListaOrdenadaEsparsa;
+
+        void pularSegmentosVazios()
+        {
+            while (segmento < lista->numeroSegmentos && deslocamento >= lista->ocupados[segmento])
+            {
+                segmento++;
+                deslocamento = 0;
+            }
+        }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Elemento *value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Elemento *const *pointer;
+        typedef Elemento *const &reference;
+
+        Iterador() : lista(nullptr), segmento(0), deslocamento(0) {}
+        reference operator*() const { return lista->elementos[segmento * lista->tamanhoSegmento + deslocamento]; }
+        pointer operator->() const { return &**this; }
+        Iterador &operator++()
+        {
+            deslocamento++;
+            pularSegmentosVazios();
+            return *this;
+        }
+        Iterador operator++(int)
+        {
+            Iterador anterior = *this;
+            ++*this;
+            return anterior;
+        }
+        bool operator==(const Iterador &outro) const
+        {
+            return segmento == outro.segmento && deslocamento == outro.deslocamento;
+        }
+        bool operator!=(const Iterador &outro) const { return !(*this == outro); }
+    };
+
+    /**
+     * Construtor da Lista Ordenada Esparsa
+     */
+    ListaOrdenadaEsparsa();
+
+    /**
+     * Destrutor da Lista Ordenada Esparsa
+     */
+    ~ListaOrdenadaEsparsa();
+
+    ListaOrdenadaEsparsa(const ListaOrdenadaEsparsa &) = delete;
+    ListaOrdenadaEsparsa &operator=(const ListaOrdenadaEsparsa &) = delete;
+
+    /**
+     * Insere um elemento no início da lista (mantém ordem)
+     * @param elemento Ponteiro para o elemento a ser inserido
+     * @return true se inserido com sucesso, false caso contrário
+     * Complexidade: O(log² n) amortizado
+     */
+    bool inserirNoInicio(Elemento *elemento);
+
+    /**
+     * Insere um elemento no final da lista (mantém ordem)
+     * @param elemento Ponteiro para o elemento a ser inserido
+     * @return true se inserido com sucesso, false caso contrário
+     * Complexidade: O(log² n) amortizado
+     */
+    bool inserirNoFinal(Elemento *elemento);
+
+    /**
+     * Insere um lote de elementos mantendo a ordem
+     * O lote é ordenado, intercalado com a lista e o array é reconstruído uma vez
+     * @param primeiro Ponteiro para o primeiro ponteiro do lote
+     * @param n Número de elementos do lote
+     * @return true se todos foram inseridos, false (sem inserir nenhum) se algum
+     * ponteiro é nulo ou faltou memória
+     * Complexidade: O(n + m log m)
+     */
+    bool inserirVarios(Elemento *const *primeiro, size_t n);
+
+    /**
+     * Remove o primeiro elemento da lista
+     * @return Ponteiro para o elemento removido ou nullptr se vazia
+     * Complexidade: O(log² n) amortizado
+     */
+    Elemento *removerPrimeiro();
+
+    /**
+     * Remove o último elemento da lista
+     * @return Ponteiro para o elemento removido ou nullptr se vazia
+     * Complexidade: O(log² n) amortizado
+     */
+    Elemento *removerUltimo();
+
+    /**
+     * Remove um elemento pelo ID
+     * @param id ID do elemento a ser removido
+     * @return Ponteiro para o elemento removido ou nullptr se não encontrado
+     * Complexidade: O(log² n) amortizado
+     */
+    Elemento *removerPeloId(int id);
+
+    /**
+     * Remove, em uma única passada, todos os elementos que satisfazem o predicado
+     * @param predicado Função que recebe um elemento e retorna true se ele deve sair
+     * @param removidos Se informado, recebe os elementos removidos (na ordem da lista)
+     * e o chamador passa a ser dono deles; se nullptr, os elementos são liberados
+     * @return Número de elementos removidos
+     * Complexidade: O(n) - Reconstrói o array uma vez
+     */
+    int removerSe(const std::function<bool(const Elemento *)> &predicado,
+                  std::vector<Elemento *> *removidos = nullptr);
+
+    /**
+     * Busca um elemento pelo ID
+     * @param id ID do elemento a ser buscado
+     * @return Ponteiro para o primeiro elemento com o ID ou nullptr se não encontrado
+     * Complexidade: O(log n) - Busca binária nos segmentos e no segmento
+     */
+    Elemento *buscarPeloId(int id) const;
+
+    /**
+     * Altera um elemento pelo ID
+     * @param id ID do elemento a ser alterado
+     * @param novoElemento Ponteiro para o novo elemento
+     * @return true se alterado com sucesso, false caso contrário
+     * Complexidade: O(log² n) amortizado
+     */
+    bool alterarPeloId(int id, Elemento *novoElemento);
+
+    /**
+     * Verifica se a lista está vazia
+     * @return true se vazia, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool estaVazia() const { return tamanho == 0; }
+
+    /**
+     * Obtém o tamanho atual da lista
+     * @return Número de elementos na lista
+     * Complexidade: O(1)
+     */
+    int getTamanho() const { return tamanho; }
+
+    /**
+     * Obtém o número de posições do array, incluindo as lacunas
+     * @return Capacidade atual
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const { return capacidade; }
+
+    /**
+     * Imprime todos os elementos da lista
+     * Complexidade: O(capacidade)
+     */
+    void imprimirTodos() const;
+
+    /**
+     * Visita todos os elementos em ordem crescente de ID, sem cópias nem impressão
+     * @param visitante Função chamada uma vez para cada elemento
+     * Complexidade: O(capacidade)
+     */
+    void paraCada(const std::function<void(const Elemento *)> &visitante) const;
+
+    /**
+     * Iterador para o primeiro elemento
+     * Complexidade: O(1) - O primeiro segmento só fica vazio com a lista vazia
+     */
+    Iterador begin() const
+    {
+        Iterador inicio(this, 0, 0);
+        inicio.pularSegmentosVazios();
+        return inicio;
+    }
+
+    /**
+     * Iterador para depois do último elemento
+     * Complexidade: O(1)
+     */
+    Iterador end() const { return Iterador(this, numeroSegmentos, 0); }
+};
+
+#endif // LISTA_ORDENADA_ESPARSA_H
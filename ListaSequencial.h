@@ -0,0 +1,523 @@
+#ifndef LISTA_SEQUENCIAL_H
+#define LISTA_SEQUENCIAL_H
+
+#include "Elemento.h"
+#include "OperacoesVetoriais.h"
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Classe que implementa uma Lista Não Ordenada com alocação sequencial que
+ * armazena os elementos por valor (ex.: ListaSequencial<Pessoa>).
+ * Ao contrário da ListaNaoOrdenada, que guarda um ponteiro para cada objeto
+ * alocado separadamente, os objetos ficam lado a lado em um único bloco de
+ * memória: percorrer a lista lê memória contígua e inserir não aloca nada
+ * além do crescimento geométrico do bloco.
+ * Os IDs são replicados em um array de int paralelo, como na ListaNaoOrdenada,
+ * para que a busca pelo ID compare vários IDs por instrução (OperacoesVetoriais).
+ * Por ser um template, toda a implementação fica neste cabeçalho.
+ * Demonstra o pilar da Abstração: o mesmo código serve para qualquer Elemento concreto.
+ */
+template <typename T>
+class ListaSequencial
+{
+    static_assert(std::is_base_of<Elemento, T>::value, "ListaSequencial armazena apenas classes derivadas de Elemento");
+
+private:
+    static const int CAPACIDADE_INICIAL = 16; // Capacidade alocada na construção
+    T *elementos;                             // Bloco contíguo de objetos (construídos até "tamanho")
+    int *ids;                                 // IDs dos elementos, na mesma ordem de elementos
+    int tamanho;                              // Número atual de elementos na lista
+    int capacidade;                           // Capacidade atual do bloco
+    double fatorCrescimento;                  // Fator aplicado à capacidade a cada realocação
+
+    /**
+     * Realoca o bloco para a capacidade informada, movendo os objetos
+     * @param novaCapacidade Nova capacidade (deve ser >= tamanho)
+     * @return true se realocou, false se faltou memória (a lista não é alterada)
+     * Complexidade: O(n) - Move todos os objetos
+     */
+    bool realocar(int novaCapacidade)
+    {
+        T *novosElementos = static_cast<T *>(::operator new(sizeof(T) * static_cast<size_t>(novaCapacidade), std::nothrow));
+        int *novosIds = new (std::nothrow) int[novaCapacidade];
+        if (novosElementos == nullptr || novosIds == nullptr)
+        {
+            ::operator delete(novosElementos);
+            delete[] novosIds;
+            return false;
+        }
+
+        for (int i = 0; i < tamanho; i++)
+        {
+            new (novosElementos + i) T(std::move(elementos[i]));
+            elementos[i].~T();
+            novosIds[i] = ids[i];
+        }
+
+        ::operator delete(elementos);
+        delete[] ids;
+        elementos = novosElementos;
+        ids = novosIds;
+        capacidade = novaCapacidade;
+        return true;
+    }
+
+    /**
+     * Garante espaço para pelo menos "quantidade" elementos além dos atuais,
+     * crescendo geometricamente
+     * @param quantidade Número de elementos a inserir
+     * @return true se há espaço disponível, false caso contrário
+     * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+     */
+    bool garantirEspacoPara(size_t quantidade)
+    {
+        if (quantidade <= static_cast<size_t>(capacidade - tamanho))
+        {
+            return true;
+        }
+        if (quantidade > static_cast<size_t>(INT_MAX - tamanho))
+        {
+            return false;
+        }
+
+        long long minimo = static_cast<long long>(tamanho) + static_cast<long long>(quantidade);
+        double desejada = capacidade * fatorCrescimento;
+        if (desejada < minimo)
+        {
+            desejada = static_cast<double>(minimo);
+        }
+        return realocar(desejada >= INT_MAX ? INT_MAX : static_cast<int>(desejada));
+    }
+
+    /**
+     * Verifica se um objeto está dentro do bloco da lista (uma realocação o invalidaria)
+     * @param objeto Endereço do objeto
+     * @return true se o objeto é um dos elementos da lista
+     * Complexidade: O(1)
+     */
+    bool pertence(const T *objeto) const
+    {
+        std::less<const T *> menor;
+        return !menor(objeto, elementos) && menor(objeto, elementos + tamanho);
+    }
+
+    /**
+     * Remove o elemento da posição informada, deslocando os seguintes
+     * @param posicao Posição do elemento (0 <= posicao < tamanho)
+     * @param removido Se não for nullptr, recebe o elemento removido
+     * Complexidade: O(n - posicao)
+     */
+    void removerNaPosicao(int posicao, T *removido)
+    {
+        if (removido != nullptr)
+        {
+            *removido = std::move(elementos[posicao]);
+        }
+        for (int i = posicao; i < tamanho - 1; i++)
+        {
+            elementos[i] = std::move(elementos[i + 1]);
+            ids[i] = ids[i + 1];
+        }
+        elementos[tamanho - 1].~T();
+        tamanho--;
+    }
+
+public:
+    /**
+     * Construtor da Lista Sequencial
+     * @param capacidadeInicial Capacidade alocada na construção
+     * @param fatorCrescimento Fator de crescimento da capacidade (deve ser > 1)
+     */
+    ListaSequencial(int capacidadeInicial = CAPACIDADE_INICIAL, double fatorCrescimento = 2.0)
+        : elementos(nullptr), ids(nullptr), tamanho(0), capacidade(0),
+          fatorCrescimento(fatorCrescimento > 1.0 ? fatorCrescimento : 2.0)
+    {
+        realocar(capacidadeInicial > 0 ? capacidadeInicial : 1);
+    }
+
+    /**
+     * Destrutor da Lista Sequencial
+     * Complexidade: O(n) - Destrói todos os objetos
+     */
+    ~ListaSequencial()
+    {
+        for (int i = 0; i < tamanho; i++)
+        {
+            elementos[i].~T();
+        }
+        ::operator delete(elementos);
+        delete[] ids;
+    }
+
+    // A lista é dona do bloco de memória: cópias compartilhariam o mesmo bloco
+    ListaSequencial(const ListaSequencial &) = delete;
+    ListaSequencial &operator=(const ListaSequencial &) = delete;
+
+    /**
+     * Insere uma cópia do elemento no final da lista
+     * @param elemento Elemento a ser copiado para a lista
+     * @return true se inserido com sucesso, false se faltou memória
+     * Complexidade: O(1) amortizado
+     */
+    bool inserirNoFinal(const T &elemento)
+    {
+        if (pertence(&elemento))
+        {
+            T copia(elemento);
+            return construirNoFinal(std::move(copia));
+        }
+        return construirNoFinal(elemento);
+    }
+
+    /**
+     * Constrói um elemento diretamente no final da lista, a partir dos
+     * argumentos do construtor de T (ex.: construirNoFinal(1, "Ana", 30))
+     * @return true se inserido com sucesso, false se faltou memória
+     * Complexidade: O(1) amortizado - Nenhuma alocação por elemento
+     */
+    template <typename... Argumentos>
+    bool construirNoFinal(Argumentos &&...argumentos)
+    {
+        if (!garantirEspacoPara(1))
+        {
+            return false;
+        }
+
+        new (elementos + tamanho) T(std::forward<Argumentos>(argumentos)...);
+        ids[tamanho] = elementos[tamanho].getID();
+        tamanho++;
+        return true;
+    }
+
+    /**
+     * Insere uma cópia do elemento no início da lista
+     * @param elemento Elemento a ser copiado para a lista
+     * @return true se inserido com sucesso, false se faltou memória
+     * Complexidade: O(n) - Desloca todos os elementos para a direita
+     */
+    bool inserirNoInicio(const T &elemento)
+    {
+        if (pertence(&elemento))
+        {
+            T copia(elemento);
+            return inserirNoInicio(copia);
+        }
+        if (!garantirEspacoPara(1))
+        {
+            return false;
+        }
+        if (tamanho == 0)
+        {
+            return inserirNoFinal(elemento);
+        }
+
+        // O último objeto é movido para a posição ainda não construída
+        new (elementos + tamanho) T(std::move(elementos[tamanho - 1]));
+        ids[tamanho] = ids[tamanho - 1];
+        for (int i = tamanho - 1; i > 0; i--)
+        {
+            elementos[i] = std::move(elementos[i - 1]);
+            ids[i] = ids[i - 1];
+        }
+        elementos[0] = elemento;
+        ids[0] = elemento.getID();
+        tamanho++;
+        return true;
+    }
+
+    /**
+     * Insere no final da lista uma cópia de cada elemento do lote
+     * Reserva espaço uma única vez para o lote inteiro. O lote pode ser parte
+     * da própria lista (ex.: inserirVarios(dados(), getTamanho())): nesse caso
+     * a posição é guardada antes da realocação e o ponteiro é refeito depois
+     * @param primeiro Ponteiro para o primeiro elemento do lote
+     * @param n Número de elementos do lote
+     * @return true se todos foram inseridos, false (sem inserir nenhum) se faltou
+     * memória ou se o lote começa na lista mas passa do seu fim
+     * Complexidade: O(m) amortizado, com m o tamanho do lote
+     */
+    bool inserirVarios(const T *primeiro, size_t n)
+    {
+        if (n == 0)
+        {
+            return true;
+        }
+        if (primeiro == nullptr)
+        {
+            return false;
+        }
+
+        if (pertence(primeiro))
+        {
+            size_t posicao = static_cast<size_t>(primeiro - elementos);
+            if (n > static_cast<size_t>(tamanho) - posicao || !garantirEspacoPara(n))
+            {
+                return false;
+            }
+            // Os elementos de origem ficam antes do fim original e não se movem
+            // enquanto as cópias são construídas depois dele
+            primeiro = elementos + posicao;
+        }
+        else if (!garantirEspacoPara(n))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            new (elementos + tamanho) T(primeiro[i]);
+            ids[tamanho] = primeiro[i].getID();
+            tamanho++;
+        }
+        return true;
+    }
+
+    /**
+     * Remove o primeiro elemento da lista
+     * @param removido Se não for nullptr, recebe o elemento removido
+     * @return true se removido, false se a lista está vazia
+     * Complexidade: O(n) - Desloca todos os elementos para a esquerda
+     */
+    bool removerPrimeiro(T *removido = nullptr)
+    {
+        if (estaVazia())
+        {
+            return false;
+        }
+
+        removerNaPosicao(0, removido);
+        return true;
+    }
+
+    /**
+     * Remove o último elemento da lista
+     * @param removido Se não for nullptr, recebe o elemento removido
+     * @return true se removido, false se a lista está vazia
+     * Complexidade: O(1) - Remoção direta do final
+     */
+    bool removerUltimo(T *removido = nullptr)
+    {
+        if (estaVazia())
+        {
+            return false;
+        }
+
+        removerNaPosicao(tamanho - 1, removido);
+        return true;
+    }
+
+    /**
+     * Remove um elemento pelo ID
+     * @param id ID do elemento a ser removido
+     * @param removido Se não for nullptr, recebe o elemento removido
+     * @return true se removido, false se não encontrado
+     * Complexidade: O(n) - Busca linear + deslocamento
+     */
+    bool removerPeloId(int id, T *removido = nullptr)
+    {
+        int posicao = OperacoesVetoriais::buscarChave(ids, tamanho, id);
+        if (posicao == -1)
+        {
+            return false;
+        }
+
+        removerNaPosicao(posicao, removido);
+        return true;
+    }
+
+    /**
+     * Remove, em uma única passada, todos os elementos que satisfazem o predicado
+     * @param predicado Função que recebe um elemento e retorna true se ele deve sair
+     * @param removidos Se informado, recebe os elementos removidos (na ordem da lista)
+     * @return Número de elementos removidos
+     * Complexidade: O(n) - Compacta o bloco preservando a ordem
+     */
+    int removerSe(const std::function<bool(const T &)> &predicado, std::vector<T> *removidos = nullptr)
+    {
+        int destino = 0;
+        for (int i = 0; i < tamanho; i++)
+        {
+            if (predicado(elementos[i]))
+            {
+                if (removidos != nullptr)
+                {
+                    removidos->push_back(std::move(elementos[i]));
+                }
+                continue;
+            }
+
+            if (destino != i)
+            {
+                elementos[destino] = std::move(elementos[i]);
+                ids[destino] = ids[i];
+            }
+            destino++;
+        }
+
+        for (int i = destino; i < tamanho; i++)
+        {
+            elementos[i].~T();
+        }
+
+        int quantidadeRemovida = tamanho - destino;
+        tamanho = destino;
+        return quantidadeRemovida;
+    }
+
+    /**
+     * Busca um elemento pelo ID
+     * @param id ID do elemento a ser buscado
+     * @return Ponteiro para o elemento dentro da lista ou nullptr se não encontrado
+     * (o ponteiro deixa de ser válido na próxima inserção ou remoção)
+     * Complexidade: O(n) - Busca linear no array de IDs
+     */
+    T *buscarPeloId(int id)
+    {
+        int posicao = OperacoesVetoriais::buscarChave(ids, tamanho, id);
+        return posicao != -1 ? elementos + posicao : nullptr;
+    }
+
+    /**
+     * Busca um elemento pelo ID (versão constante)
+     * Complexidade: O(n) - Busca linear no array de IDs
+     */
+    const T *buscarPeloId(int id) const
+    {
+        int posicao = OperacoesVetoriais::buscarChave(ids, tamanho, id);
+        return posicao != -1 ? elementos + posicao : nullptr;
+    }
+
+    /**
+     * Altera um elemento pelo ID, substituindo-o por uma cópia do novo
+     * @param id ID do elemento a ser alterado
+     * @param novoElemento Elemento que ocupará a mesma posição
+     * @return true se alterado com sucesso, false se não encontrado
+     * Complexidade: O(n) - Busca linear no array de IDs
+     */
+    bool alterarPeloId(int id, const T &novoElemento)
+    {
+        int posicao = OperacoesVetoriais::buscarChave(ids, tamanho, id);
+        if (posicao == -1)
+        {
+            return false;
+        }
+
+        elementos[posicao] = novoElemento;
+        ids[posicao] = novoElemento.getID();
+        return true;
+    }
+
+    /**
+     * Reserva capacidade para pelo menos n elementos, evitando realocações
+     * @param n Número de elementos a comportar
+     * @return true se a capacidade é suficiente, false se faltou memória
+     * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+     */
+    bool reservar(int n)
+    {
+        return n <= capacidade || realocar(n);
+    }
+
+    /**
+     * Reduz a capacidade ao tamanho atual (mínimo 1)
+     * Complexidade: O(n) - Realoca e move os objetos
+     */
+    void encolher()
+    {
+        int novaCapacidade = tamanho > 0 ? tamanho : 1;
+        if (novaCapacidade < capacidade)
+        {
+            realocar(novaCapacidade);
+        }
+    }
+
+    /**
+     * Acesso direto ao bloco contíguo de elementos, para percorrê-lo sem
+     * indireção (válido até a próxima inserção ou remoção)
+     * @return Ponteiro para o primeiro elemento
+     * Complexidade: O(1)
+     */
+    const T *dados() const { return elementos; }
+
+    /**
+     * Iterador constante compatível com a STL: um ponteiro para o bloco
+     * contíguo já é um iterador de acesso aleatório
+     */
+    typedef const T *Iterador;
+
+    /**
+     * Iterador para o primeiro elemento
+     * Complexidade: O(1)
+     */
+    Iterador begin() const { return elementos; }
+
+    /**
+     * Iterador para depois do último elemento
+     * Complexidade: O(1)
+     */
+    Iterador end() const { return elementos + tamanho; }
+
+    /**
+     * Visita todos os elementos na ordem da lista, sem cópias nem impressão
+     * @param visitante Função chamada uma vez para cada elemento
+     * Complexidade: O(n)
+     */
+    void paraCada(const std::function<void(const T &)> &visitante) const
+    {
+        for (int i = 0; i < tamanho; i++)
+        {
+            visitante(elementos[i]);
+        }
+    }
+
+    /**
+     * Verifica se a lista está vazia
+     * @return true se vazia, false caso contrário
+     * Complexidade: O(1)
+     */
+    bool estaVazia() const { return tamanho == 0; }
+
+    /**
+     * Obtém o tamanho atual da lista
+     * @return Número de elementos na lista
+     * Complexidade: O(1)
+     */
+    int getTamanho() const { return tamanho; }
+
+    /**
+     * Obtém a capacidade atual do bloco
+     * @return Número de elementos que cabem sem realocar
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const { return capacidade; }
+
+    /**
+     * Imprime todos os elementos da lista
+     * Complexidade: O(n)
+     */
+    void imprimirTodos() const
+    {
+        std::cout << "=== Lista Sequencial (por valor) ===" << std::endl;
+        if (estaVazia())
+        {
+            std::cout << "Lista vazia!" << std::endl;
+            return;
+        }
+
+        for (int i = 0; i < tamanho; i++)
+        {
+            std::cout << "Posição " << i << ": ";
+            elementos[i].imprimirInfo();
+        }
+        std::cout << "Total de elementos: " << tamanho << std::endl;
+    }
+};
+
+#endif // LISTA_SEQUENCIAL_H
@@ -139,6 +139,44 @@ Elemento *ListaSimplesmenteEncadeada::removerPeloId(int id)
     return nullptr;
 }
 
+/**
+ * Remove todos os elementos que satisfazem o predicado
+ * Percorre a lista com um ponteiro para o campo de ligação a atualizar
+ * (a cabeça ou o "proximo" do nó anterior), religando os nós sem nova busca
+ * Complexidade: O(n)
+ */
+int ListaSimplesmenteEncadeada::removerSe(const std::function<bool(const Elemento *)> &predicado,
+                                          std::vector<Elemento *> *removidos)
+{
+    int quantidadeRemovida = 0;
+    No **ligacao = &cabeca;
+
+    while (*ligacao != nullptr)
+    {
+        No *atual = *ligacao;
+        if (!predicado(atual->elemento))
+        {
+            ligacao = &atual->proximo;
+            continue;
+        }
+
+        *ligacao = atual->proximo;
+        if (removidos != nullptr)
+        {
+            removidos->push_back(atual->elemento);
+        }
+        else
+        {
+            delete atual->elemento;
+        }
+        delete atual;
+        quantidadeRemovida++;
+    }
+
+    tamanho -= quantidadeRemovida;
+    return quantidadeRemovida;
+}
+
 /**
  * Busca um elemento pelo ID
  * Complexidade: O(n) - Busca linear
@@ -149,6 +187,25 @@ Elemento *ListaSimplesmenteEncadeada::buscarPeloId(int id) const
     return (no != nullptr) ? no->elemento : nullptr;
 }
 
+/**
+ * Obtém o último elemento da lista, sem removê-lo
+ * Complexidade: O(n) - Percorre até o último nó
+ */
+Elemento *ListaSimplesmenteEncadeada::ultimo() const
+{
+    if (cabeca == nullptr)
+    {
+        return nullptr;
+    }
+
+    No *atual = cabeca;
+    while (atual->proximo != nullptr)
+    {
+        atual = atual->proximo;
+    }
+    return atual->elemento;
+}
+
 /**
  * Altera um elemento pelo ID
  * Complexidade: O(n) - Busca linear
@@ -246,3 +303,15 @@ void ListaSimplesmenteEncadeada::imprimirTodos() const
     }
     std::cout << "Total de elementos: " << tamanho << std::endl;
 }
+
+/**
+ * Visita todos os elementos do início ao fim
+ * Complexidade: O(n)
+ */
+void ListaSimplesmenteEncadeada::paraCada(const std::function<void(const Elemento *)> &visitante) const
+{
+    for (No *atual = cabeca; atual != nullptr; atual = atual->proximo)
+    {
+        visitante(atual->elemento);
+    }
+}
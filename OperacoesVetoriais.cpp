@@ -0,0 +1,246 @@
+#include "OperacoesVetoriais.h"
+#include <algorithm>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * Busca linear pela primeira ocorrência de uma chave
+ * Compara um bloco de chaves de uma vez e usa a máscara de bits do resultado
+ * (movemask) para localizar a primeira igualdade; o resto é tratado escalarmente
+ * Complexidade: O(n)
+ */
+int OperacoesVetoriais::buscarChave(const int *chaves, int n, int chave)
+{
+    int i = 0;
+
+#if defined(__AVX2__)
+    const __m256i alvo = _mm256_set1_epi32(chave);
+    for (; i + 16 <= n; i += 16)
+    {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(chaves + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(chaves + i + 8));
+        unsigned mascaraA = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, alvo))));
+        unsigned mascaraB = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(b, alvo))));
+        unsigned mascara = mascaraA | (mascaraB << 8);
+        if (mascara != 0)
+        {
+            return i + __builtin_ctz(mascara);
+        }
+    }
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(chaves + i));
+        unsigned mascara = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, alvo))));
+        if (mascara != 0)
+        {
+            return i + __builtin_ctz(mascara);
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i alvo = _mm_set1_epi32(chave);
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(chaves + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(chaves + i + 4));
+        unsigned mascaraA = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, alvo))));
+        unsigned mascaraB = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(b, alvo))));
+        unsigned mascara = mascaraA | (mascaraB << 4);
+        if (mascara != 0)
+        {
+            return i + __builtin_ctz(mascara);
+        }
+    }
+#endif
+
+    // Implementação escalar (e tratamento das chaves restantes)
+    for (; i < n; i++)
+    {
+        if (chaves[i] == chave)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Avança até a primeira chave >= chave por busca exponencial
+ * Complexidade: O(log d)
+ */
+int OperacoesVetoriais::galopar(const int *chaves, int inicio, int n, int chave)
+{
+    if (inicio >= n || chaves[inicio] >= chave)
+    {
+        return inicio;
+    }
+
+    // chaves[inicio + passo / 2] < chave: o limite está em (inicio + passo / 2, inicio + passo]
+    long long passo = 1;
+    while (passo <= n - inicio - 1 && chaves[inicio + passo] < chave)
+    {
+        passo *= 2;
+    }
+    int primeiro = inicio + static_cast<int>(passo / 2) + 1;
+    int ultimo = static_cast<int>(std::min(static_cast<long long>(n), inicio + passo));
+    return static_cast<int>(std::lower_bound(chaves + primeiro, chaves + ultimo, chave) - chaves);
+}
+
+/**
+ * Interseção de dois arrays ordenados de chaves
+ * No caso vetorial, a máscara de um bloco de "a" acumula as igualdades com
+ * todos os blocos de "b" comparados a ele e só é emitida quando o bloco de "a"
+ * avança (quando seu máximo não passa do máximo do bloco de "b"; em caso de
+ * empate, só "a" avança, para que chaves repetidas no bloco seguinte ainda
+ * encontrem as de "b"). As chaves que sobram são tratadas escalarmente
+ * Complexidade: O(na + nb), ou O(m log(M / m)) ao galopar
+ */
+int OperacoesVetoriais::intersecaoOrdenada(const int *a, int na, const int *b, int nb, int *posicoes)
+{
+    int quantidade = 0;
+    if (na == 0 || nb == 0)
+    {
+        return 0;
+    }
+
+    // "b" muito maior: cada chave de "a" galopa em "b"
+    if (nb / RAZAO_GALOPE > na)
+    {
+        int j = 0;
+        for (int i = 0; i < na; i++)
+        {
+            j = galopar(b, j, nb, a[i]);
+            if (j == nb)
+            {
+                break;
+            }
+            if (b[j] == a[i])
+            {
+                posicoes[quantidade++] = i;
+            }
+        }
+        return quantidade;
+    }
+
+    // "a" muito maior: cada chave distinta de "b" galopa em "a"
+    if (na / RAZAO_GALOPE > nb)
+    {
+        int i = 0;
+        for (int j = 0; j < nb && i < na; j++)
+        {
+            if (j > 0 && b[j] == b[j - 1])
+            {
+                continue;
+            }
+            i = galopar(a, i, na, b[j]);
+            while (i < na && a[i] == b[j])
+            {
+                posicoes[quantidade++] = i++;
+            }
+        }
+        return quantidade;
+    }
+
+    int i = 0;
+    int j = 0;
+    unsigned acumulada = 0; // Igualdades já encontradas para o bloco atual de "a"
+
+#if defined(__AVX2__)
+    const __m256i rotacao = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    while (i + 8 <= na && j + 8 <= nb)
+    {
+        __m256i blocoA = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        __m256i blocoB = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + j));
+        __m256i iguais = _mm256_cmpeq_epi32(blocoA, blocoB);
+        for (int r = 1; r < 8; r++)
+        {
+            blocoB = _mm256_permutevar8x32_epi32(blocoB, rotacao);
+            iguais = _mm256_or_si256(iguais, _mm256_cmpeq_epi32(blocoA, blocoB));
+        }
+        acumulada |= static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(iguais)));
+
+        int maximoA = a[i + 7];
+        int maximoB = b[j + 7];
+        if (maximoA <= maximoB)
+        {
+            while (acumulada != 0)
+            {
+                posicoes[quantidade++] = i + __builtin_ctz(acumulada);
+                acumulada &= acumulada - 1;
+            }
+            i += 8;
+        }
+        else
+        {
+            j += 8;
+        }
+    }
+#elif defined(__SSE2__)
+    while (i + 4 <= na && j + 4 <= nb)
+    {
+        __m128i blocoA = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        __m128i blocoB = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+        __m128i iguais = _mm_cmpeq_epi32(blocoA, blocoB);
+        blocoB = _mm_shuffle_epi32(blocoB, _MM_SHUFFLE(0, 3, 2, 1));
+        iguais = _mm_or_si128(iguais, _mm_cmpeq_epi32(blocoA, blocoB));
+        blocoB = _mm_shuffle_epi32(blocoB, _MM_SHUFFLE(0, 3, 2, 1));
+        iguais = _mm_or_si128(iguais, _mm_cmpeq_epi32(blocoA, blocoB));
+        blocoB = _mm_shuffle_epi32(blocoB, _MM_SHUFFLE(0, 3, 2, 1));
+        iguais = _mm_or_si128(iguais, _mm_cmpeq_epi32(blocoA, blocoB));
+        acumulada |= static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(iguais)));
+
+        int maximoA = a[i + 3];
+        int maximoB = b[j + 3];
+        if (maximoA <= maximoB)
+        {
+            while (acumulada != 0)
+            {
+                posicoes[quantidade++] = i + __builtin_ctz(acumulada);
+                acumulada &= acumulada - 1;
+            }
+            i += 4;
+        }
+        else
+        {
+            j += 4;
+        }
+    }
+#endif
+
+    // Intercalação escalar (e tratamento das chaves restantes). As chaves do
+    // bloco atual de "a" podem já ter sido encontradas em blocos anteriores de "b"
+    int inicioBloco = i;
+    for (; i < na; i++)
+    {
+        while (j < nb && b[j] < a[i])
+        {
+            j++;
+        }
+        bool encontrada = j < nb && b[j] == a[i];
+        if (i - inicioBloco < 8 && (acumulada >> (i - inicioBloco)) & 1u)
+        {
+            encontrada = true;
+        }
+        if (encontrada)
+        {
+            posicoes[quantidade++] = i;
+        }
+    }
+    return quantidade;
+}
+
+/**
+ * Informa o conjunto de instruções usado pelas operações
+ * Complexidade: O(1)
+ */
+const char *OperacoesVetoriais::conjuntoInstrucoes()
+{
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(__SSE2__)
+    return "SSE2";
+#else
+    return "escalar";
+#endif
+}
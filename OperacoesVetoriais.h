@@ -0,0 +1,63 @@
+#ifndef OPERACOES_VETORIAIS_H
+#define OPERACOES_VETORIAIS_H
+
+/**
+ * Classe utilitária com operações sobre arrays contíguos de chaves (IDs).
+ * Quando o compilador habilita AVX2 ou SSE2, as operações comparam vários IDs
+ * por instrução (SIMD); caso contrário, usam uma implementação escalar equivalente.
+ * Demonstra o pilar da Abstração: quem chama não depende do conjunto de instruções.
+ */
+class OperacoesVetoriais
+{
+private:
+    static const int RAZAO_GALOPE = 32; // Razão entre os tamanhos a partir da qual a interseção galopa
+
+    /**
+     * Avança a partir de "inicio" até a primeira chave >= chave, dobrando o
+     * passo a cada comparação e terminando com uma busca binária
+     * @param chaves Array ordenado de chaves
+     * @param inicio Primeira posição considerada
+     * @param n Número de chaves no array
+     * @param chave Chave procurada
+     * @return Posição da primeira chave >= chave a partir de inicio (n se não houver)
+     * Complexidade: O(log d), com d a distância percorrida
+     */
+    static int galopar(const int *chaves, int inicio, int n, int chave);
+
+public:
+    /**
+     * Busca linear pela primeira ocorrência de uma chave
+     * @param chaves Array de chaves
+     * @param n Número de chaves no array
+     * @param chave Chave procurada
+     * @return Posição da primeira ocorrência ou -1 se não encontrada
+     * Complexidade: O(n) - 8 chaves por comparação com AVX2, 4 com SSE2
+     */
+    static int buscarChave(const int *chaves, int n, int chave);
+
+    /**
+     * Interseção de dois arrays ordenados de chaves: encontra as posições de "a"
+     * cujas chaves aparecem em "b" (chaves repetidas em "a" são todas incluídas)
+     * Com tamanhos parecidos, compara blocos de 8 chaves de "a" com 8 de "b"
+     * (todas contra todas, por rotações do bloco de "b") e avança o bloco de
+     * menor máximo; se um array é RAZAO_GALOPE vezes maior que o outro, cada
+     * chave do menor é procurada no maior por busca exponencial (galope)
+     * @param a Array ordenado de chaves
+     * @param na Número de chaves de a
+     * @param b Array ordenado de chaves
+     * @param nb Número de chaves de b
+     * @param posicoes Recebe as posições de a, em ordem crescente (espaço para na posições)
+     * @return Número de posições escritas
+     * Complexidade: O(na + nb), ou O(m log(M / m)) com m o menor tamanho e M o maior
+     */
+    static int intersecaoOrdenada(const int *a, int na, const int *b, int nb, int *posicoes);
+
+    /**
+     * Informa o conjunto de instruções usado pelas operações
+     * @return "AVX2", "SSE2" ou "escalar"
+     * Complexidade: O(1)
+     */
+    static const char *conjuntoInstrucoes();
+};
+
+#endif // OPERACOES_VETORIAIS_H
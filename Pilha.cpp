@@ -4,7 +4,7 @@
 /**
  * Empilha um elemento (adiciona no topo)
  * Usa inserirNoFinal da lista para ter complexidade O(1)
- * Complexidade: O(1) - Inserção no final da lista
+ * Complexidade: O(1) amortizado - Inserção no final da lista
  */
 bool Pilha::empilhar(Elemento *elemento)
 {
@@ -30,31 +30,12 @@ Elemento *Pilha::desempilhar()
 
 /**
  * Consulta o elemento do topo sem removê-lo
- * Complexidade: O(1) - Acesso direto através de busca pela posição
+ * Complexidade: O(1) - Acesso direto ao último elemento do array
  */
 Elemento *Pilha::consultarTopo() const
 {
-    if (pilhaVazia())
-    {
-        return nullptr;
-    }
-
-    // Para acessar o último elemento, precisamos usar um método auxiliar
-    // Como não temos acesso direto ao array, usamos um workaround
-    // Criamos uma cópia temporária para acessar o último elemento
-    int tamanhoAtual = lista.getTamanho();
-    if (tamanhoAtual > 0)
-    {
-        // Infelizmente, nossa implementação de lista não tem acesso direto por índice
-        // Vamos implementar um método que busca do final para o início
-        // Por enquanto, vamos usar uma abordagem menos eficiente
-
-        // Nota: Esta implementação poderia ser melhorada com um método getElementoPorIndice na lista
-        // Para manter a interface da lista simples, vamos aceitar esta limitação
-        return nullptr; // Placeholder - implementação completa requer modificação na lista
-    }
-
-    return nullptr;
+    // O topo é o último elemento da lista
+    return lista.ultimo();
 }
 
 /**
@@ -28,7 +28,7 @@ public:
      * Empilha um elemento (adiciona no topo)
      * @param elemento Ponteiro para o elemento a ser empilhado
      * @return true se empilhado com sucesso, false caso contrário
-     * Complexidade: O(1) - Inserção no final da lista
+     * Complexidade: O(1) amortizado - Inserção no final da lista
      */
     bool empilhar(Elemento *elemento);
 
@@ -30,33 +30,12 @@ Elemento *PilhaEncadeada::desempilhar()
 
 /**
  * Consulta o elemento do topo sem removê-lo
- * Complexidade: O(1) - Busca pelo primeiro elemento
+ * Complexidade: O(1) - Acesso direto ao primeiro elemento
  */
 Elemento *PilhaEncadeada::consultarTopo() const
 {
-    if (pilhaVazia())
-    {
-        return nullptr;
-    }
-
     // Para uma pilha, o topo corresponde ao primeiro elemento da lista
-    // Vamos implementar uma busca simples (idealmente a lista teria um método para isso)
-    // Como sabemos que há pelo menos um elemento, podemos usar uma abordagem criativa
-
-    // Criamos uma cópia temporária da lista para simular o acesso ao primeiro elemento
-    // Isso não é ideal, mas mantém a interface da lista simples
-    ListaSimplesmenteEncadeada *listaTemp = const_cast<ListaSimplesmenteEncadeada *>(&lista);
-
-    // Removemos temporariamente o primeiro elemento
-    Elemento *topo = listaTemp->removerPrimeiro();
-
-    // Inserimos de volta no início
-    if (topo != nullptr)
-    {
-        listaTemp->inserirNoInicio(topo);
-    }
-
-    return topo;
+    return lista.primeiro();
 }
 
 /**
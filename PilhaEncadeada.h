@@ -43,7 +43,7 @@ public:
     /**
      * Consulta o elemento do topo sem removê-lo
      * @return Ponteiro para o elemento do topo ou nullptr se vazia
-     * Complexidade: O(1) - Busca pelo primeiro elemento
+     * Complexidade: O(1) - Acesso direto ao primeiro elemento
      */
     Elemento *consultarTopo() const;
 
@@ -0,0 +1,1998 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Produto.h"
+#include "ListaNaoOrdenada.h"
+#include "ListaOrdenada.h"
+#include "ListaOrdenadaCongelada.h"
+#include "ListaOrdenadaEsparsa.h"
+#include "ListaSequencial.h"
+#include "OperacoesVetoriais.h"
+#include "Pilha.h"
+#include "Fila.h"
+#include "FilaOtimizada.h"
+#include "FilaMPMC.h"
+#include "FilaSPSC.h"
+#include "ListaSimplesmenteEncadeada.h"
+#include "ListaDuplamenteEncadeada.h"
+#include "ListaDuplamenteEncadeadaCircular.h"
+#include "PilhaEncadeada.h"
+#include "FilaEncadeada.h"
+#include "FilaBloqueante.h"
+#include "Deque.h"
+#include "ArvoreBinariaBusca.h"
+
+/**
+ * Programa de medição de desempenho das estruturas de dados.
+ * Compilado separadamente do programa de demonstração (make bench),
+ * com otimizações habilitadas.
+ * Primeiro executa a suíte por operação (todas as estruturas, tamanhos de 10
+ * até o máximo, mediana e p99 por operação); depois, os experimentos que
+ * comparam variantes de uma mesma estrutura.
+ * Uso: ./benchmark [tamanhoMaximo] (padrão: 10000000), que limita os tamanhos
+ * da suíte e de todos os experimentos
+ */
+
+typedef std::chrono::steady_clock Relogio;
+
+/**
+ * Função auxiliar para imprimir separador
+ */
+void imprimirSeparador(const std::string &titulo)
+{
+    std::cout << "\n"
+              << std::string(60, '=') << std::endl;
+    std::cout << "  " << titulo << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+}
+
+const int AMOSTRAS_MAXIMAS = 101;          // Amostras por medição (p99 significativo)
+const int AMOSTRAS_MINIMAS = 11;           // Mínimo de amostras, mesmo acima do orçamento
+const double ORCAMENTO_POR_MEDICAO = 0.25; // Segundos medidos por operação e estrutura
+const double DURACAO_ALVO_LOTE = 20e-6;    // Duração alvo de um lote (acima da resolução do relógio)
+const int AQUECIMENTO = 3;                 // Lotes executados antes das amostras
+
+long long sumidouro = 0; // Acumula resultados para o compilador não eliminar as operações
+
+/**
+ * Resultado da medição de uma operação em uma estrutura
+ */
+struct Medicao
+{
+    std::string operacao;
+    std::string estrutura;
+    double mediana; // ns por operação
+    double p99;     // ns por operação
+    int amostras;
+};
+
+/**
+ * Dados compartilhados pelas medições de um tamanho
+ */
+struct Cenario
+{
+    int tamanho;
+    std::vector<int> ids;         // IDs presentes (pares), em ordem aleatória
+    std::vector<int> consultas;   // Sequência de IDs presentes para buscas
+    std::vector<int> ausentes;    // Sequência de IDs ausentes (ímpares) para buscas
+    std::vector<Medicao> medicoes; // Resultados de todas as estruturas
+};
+
+/**
+ * Mede uma operação: executa lotes de aquecimento, calibra o número de operações
+ * por lote e coleta amostras até AMOSTRAS_MAXIMAS ou até esgotar o orçamento
+ * @param preparar Executada fora da medição antes de cada lote (com o tamanho do
+ * lote) e ao final (com 0): desfaz o lote anterior e prepara o próximo
+ * @param executar Executa um lote com o número de operações informado (medido)
+ * @param loteMaximo Maior número de operações por lote
+ * @param divisor Unidades por operação (ex.: elementos visitados em um percurso)
+ */
+Medicao medir(const std::string &operacao, const std::string &estrutura,
+              const std::function<void(int)> &preparar, const std::function<void(int)> &executar,
+              int loteMaximo, double divisor = 1.0)
+{
+    // Aquecimento e calibração com lotes de uma operação
+    double menor = 1e30;
+    for (int i = 0; i < AQUECIMENTO; i++)
+    {
+        preparar(1);
+        Relogio::time_point inicio = Relogio::now();
+        executar(1);
+        double duracao = std::chrono::duration<double>(Relogio::now() - inicio).count();
+        menor = std::min(menor, duracao);
+    }
+
+    int lote = static_cast<int>(DURACAO_ALVO_LOTE / std::max(menor, 1e-9));
+    lote = std::max(1, std::min(lote, loteMaximo));
+
+    std::vector<double> amostras;
+    double total = 0;
+    while (static_cast<int>(amostras.size()) < AMOSTRAS_MAXIMAS &&
+           (total < ORCAMENTO_POR_MEDICAO || static_cast<int>(amostras.size()) < AMOSTRAS_MINIMAS))
+    {
+        preparar(lote);
+        Relogio::time_point inicio = Relogio::now();
+        executar(lote);
+        double duracao = std::chrono::duration<double>(Relogio::now() - inicio).count();
+        total += duracao;
+        amostras.push_back(duracao * 1e9 / lote / divisor);
+    }
+    preparar(0);
+
+    std::sort(amostras.begin(), amostras.end());
+    int quantidade = static_cast<int>(amostras.size());
+    int posicaoP99 = std::min(quantidade - 1, static_cast<int>(std::ceil(quantidade * 0.99)) - 1);
+
+    Medicao medicao;
+    medicao.operacao = operacao;
+    medicao.estrutura = estrutura;
+    medicao.mediana = amostras[quantidade / 2];
+    medicao.p99 = amostras[posicaoP99];
+    medicao.amostras = quantidade;
+    return medicao;
+}
+
+/**
+ * Maior lote para operações que alteram a estrutura: limita a variação do
+ * tamanho durante o lote a 10%
+ */
+int loteAlterando(const Cenario &cenario)
+{
+    return std::max(1, std::min(1000, cenario.tamanho / 10));
+}
+
+/**
+ * Cria os elementos que serão inseridos e removidos pelas medições de inserção
+ * (IDs ímpares distintos, ausentes da estrutura e espalhados pela faixa de IDs)
+ */
+std::vector<Elemento *> criarReserva(const Cenario &cenario)
+{
+    std::vector<Elemento *> reserva(loteAlterando(cenario));
+    for (size_t i = 0; i < reserva.size(); i++)
+    {
+        reserva[i] = new Produto(cenario.ausentes[i], "Produto", 1.0, 1);
+    }
+    return reserva;
+}
+
+/**
+ * Libera os elementos da reserva
+ */
+void liberarReserva(std::vector<Elemento *> &reserva)
+{
+    for (Elemento *elemento : reserva)
+    {
+        delete elemento;
+    }
+    reserva.clear();
+}
+
+/**
+ * Mede uma inserção: cada lote insere elementos da reserva e a preparação do
+ * lote seguinte os retira novamente, mantendo o tamanho da estrutura
+ * @param inserir Insere um elemento
+ * @param desfazer Retira um elemento inserido (recebe o elemento inserido e
+ * retorna o elemento retirado, que volta para a reserva)
+ */
+void medirInsercao(Cenario &cenario, const std::string &operacao, const std::string &estrutura,
+                   const std::function<void(Elemento *)> &inserir,
+                   const std::function<Elemento *(Elemento *)> &desfazer)
+{
+    std::vector<Elemento *> reserva = criarReserva(cenario);
+    int pendentes = 0;
+
+    cenario.medicoes.push_back(medir(
+        operacao, estrutura,
+        [&](int)
+        {
+            for (int i = 0; i < pendentes; i++)
+            {
+                reserva[i] = desfazer(reserva[i]);
+            }
+            pendentes = 0;
+        },
+        [&](int lote)
+        {
+            for (int i = 0; i < lote; i++)
+            {
+                inserir(reserva[i]);
+            }
+            pendentes = lote;
+        },
+        static_cast<int>(reserva.size())));
+
+    liberarReserva(reserva);
+}
+
+/**
+ * Mede uma remoção: cada lote remove elementos e a preparação do lote seguinte
+ * os devolve à estrutura, mantendo o seu tamanho
+ * @param remover Remove um elemento (recebe o número da remoção no lote)
+ * @param refazer Devolve um elemento removido à estrutura
+ */
+void medirRemocao(Cenario &cenario, const std::string &operacao, const std::string &estrutura,
+                  const std::function<Elemento *(int)> &remover,
+                  const std::function<void(Elemento *)> &refazer)
+{
+    std::vector<Elemento *> removidos(loteAlterando(cenario));
+    int pendentes = 0;
+
+    cenario.medicoes.push_back(medir(
+        operacao, estrutura,
+        [&](int)
+        {
+            for (int i = 0; i < pendentes; i++)
+            {
+                refazer(removidos[i]);
+            }
+            pendentes = 0;
+        },
+        [&](int lote)
+        {
+            for (int i = 0; i < lote; i++)
+            {
+                removidos[i] = remover(i);
+            }
+            pendentes = lote;
+        },
+        static_cast<int>(removidos.size())));
+}
+
+/**
+ * Mede uma operação que não altera a estrutura
+ * @param executar Executa a operação (recebe o número da operação)
+ */
+void medirConsulta(Cenario &cenario, const std::string &operacao, const std::string &estrutura,
+                   const std::function<void(int)> &executar)
+{
+    int proxima = 0;
+    cenario.medicoes.push_back(medir(
+        operacao, estrutura, [](int) {},
+        [&](int lote)
+        {
+            for (int i = 0; i < lote; i++)
+            {
+                executar(proxima++);
+            }
+        },
+        100000));
+}
+
+/**
+ * Mede um percurso completo, reportando o custo por elemento visitado
+ * @param percorrer Visita todos os elementos uma vez
+ */
+void medirPercurso(Cenario &cenario, const std::string &operacao, const std::string &estrutura,
+                   const std::function<void()> &percorrer)
+{
+    cenario.medicoes.push_back(medir(
+        operacao, estrutura, [](int) {},
+        [&](int lote)
+        {
+            for (int i = 0; i < lote; i++)
+            {
+                percorrer();
+            }
+        },
+        1000, cenario.tamanho));
+}
+
+/**
+ * ID presente da i-ésima busca (a sequência é repetida ciclicamente)
+ */
+inline int idPresente(const Cenario &cenario, int i)
+{
+    return cenario.consultas[i & (cenario.consultas.size() - 1)];
+}
+
+/**
+ * ID ausente da i-ésima busca (a sequência é repetida ciclicamente)
+ */
+inline int idAusente(const Cenario &cenario, int i)
+{
+    return cenario.ausentes[i & (cenario.ausentes.size() - 1)];
+}
+
+/**
+ * ID presente a remover na i-ésima remoção: percorre a permutação aleatória dos
+ * IDs, de modo que um lote nunca remove o mesmo ID duas vezes
+ */
+int idARemover(const Cenario &cenario, int &cursor)
+{
+    int id = cenario.ids[cursor];
+    cursor = cursor + 1 < cenario.tamanho ? cursor + 1 : 0;
+    return id;
+}
+
+/**
+ * Mede as operações comuns às estruturas com busca pelo ID
+ * (buscarPeloId com acerto e com falha, removerPeloId)
+ */
+template <typename Estrutura, typename Reinserir>
+void medirOperacoesPorId(Cenario &cenario, const std::string &nome, Estrutura &estrutura, Reinserir reinserir)
+{
+    medirConsulta(cenario, "buscarPeloId (acerto)", nome, [&](int i)
+                  { sumidouro += estrutura.buscarPeloId(idPresente(cenario, i)) != nullptr; });
+    medirConsulta(cenario, "buscarPeloId (falha)", nome, [&](int i)
+                  { sumidouro += estrutura.buscarPeloId(idAusente(cenario, i)) != nullptr; });
+
+    int cursor = 0;
+    medirRemocao(
+        cenario, "removerPeloId", nome,
+        [&](int)
+        { return estrutura.removerPeloId(idARemover(cenario, cursor)); },
+        reinserir);
+}
+
+/**
+ * Mede os dois percursos (iterador e paraCada) de uma estrutura de ponteiros
+ * (não const: os iteradores da ListaOrdenada descarregam o buffer de escrita)
+ */
+template <typename Estrutura>
+void medirPercursos(Cenario &cenario, const std::string &nome, Estrutura &estrutura)
+{
+    medirPercurso(cenario, "percorrer (iterador)", nome, [&]()
+                  {
+                      for (Elemento *elemento : estrutura)
+                      {
+                          sumidouro += elemento->getID();
+                      } });
+    medirPercurso(cenario, "percorrer (paraCada)", nome, [&]()
+                  { estrutura.paraCada([](const Elemento *elemento)
+                                       { sumidouro += elemento->getID(); }); });
+}
+
+/**
+ * Esvazia uma estrutura que não libera os elementos ao ser destruída
+ * @param remover Remove e retorna um elemento (nullptr quando vazia)
+ */
+void esvaziar(const std::function<Elemento *()> &remover)
+{
+    for (Elemento *elemento = remover(); elemento != nullptr; elemento = remover())
+    {
+        delete elemento;
+    }
+}
+
+/**
+ * Cria um produto com o ID informado
+ */
+Elemento *novoProduto(int id)
+{
+    return new Produto(id, "Produto", 1.0, 1);
+}
+
+/**
+ * Mede todas as operações da ListaNaoOrdenada (sem e com índice hash)
+ */
+void medirListaNaoOrdenada(Cenario &cenario, bool comIndice)
+{
+    std::string nome = comIndice ? "ListaNaoOrdenada + índice" : "ListaNaoOrdenada";
+    ListaNaoOrdenada lista(cenario.tamanho, 2.0, comIndice ? ListaNaoOrdenada::TROCAR_COM_ULTIMO : ListaNaoOrdenada::PRESERVAR_ORDEM);
+    if (comIndice)
+    {
+        lista.ativarIndice();
+    }
+    for (int id : cenario.ids)
+    {
+        lista.inserirNoFinal(novoProduto(id));
+    }
+
+    medirInsercao(
+        cenario, "inserirNoInicio", nome, [&](Elemento *elemento)
+        { lista.inserirNoInicio(elemento); },
+        [&](Elemento *)
+        { return lista.removerPrimeiro(); });
+    medirInsercao(
+        cenario, "inserirNoFinal", nome, [&](Elemento *elemento)
+        { lista.inserirNoFinal(elemento); },
+        [&](Elemento *)
+        { return lista.removerUltimo(); });
+    medirRemocao(
+        cenario, "removerPrimeiro", nome, [&](int)
+        { return lista.removerPrimeiro(); },
+        [&](Elemento *elemento)
+        { lista.inserirNoInicio(elemento); });
+    medirRemocao(
+        cenario, "removerUltimo", nome, [&](int)
+        { return lista.removerUltimo(); },
+        [&](Elemento *elemento)
+        { lista.inserirNoFinal(elemento); });
+    medirOperacoesPorId(cenario, nome, lista, [&](Elemento *elemento)
+                        { lista.inserirNoFinal(elemento); });
+    medirPercursos(cenario, nome, lista);
+}
+
+/**
+ * Mede todas as operações da ListaOrdenada
+ */
+void medirListaOrdenada(Cenario &cenario)
+{
+    std::string nome = "ListaOrdenada";
+    ListaOrdenada lista(cenario.tamanho);
+    std::vector<Elemento *> elementos;
+    elementos.reserve(cenario.tamanho);
+    for (int id : cenario.ids)
+    {
+        elementos.push_back(novoProduto(id));
+    }
+    lista.inserirVarios(elementos.data(), elementos.size());
+
+    // Na lista ordenada a posição depende do ID: os elementos da reserva têm
+    // IDs aleatórios e caem em posições aleatórias
+    medirInsercao(
+        cenario, "inserir (ordenado)", nome, [&](Elemento *elemento)
+        { lista.inserirNoFinal(elemento); },
+        [&](Elemento *elemento)
+        { return lista.removerPeloId(elemento->getID()); });
+    medirRemocao(
+        cenario, "removerPrimeiro", nome, [&](int)
+        { return lista.removerPrimeiro(); },
+        [&](Elemento *elemento)
+        { lista.inserirNoInicio(elemento); });
+    medirRemocao(
+        cenario, "removerUltimo", nome, [&](int)
+        { return lista.removerUltimo(); },
+        [&](Elemento *elemento)
+        { lista.inserirNoFinal(elemento); });
+    medirOperacoesPorId(cenario, nome, lista, [&](Elemento *elemento)
+                        { lista.inserirNoFinal(elemento); });
+    medirPercursos(cenario, nome, lista);
+}
+
+/**
+ * Mede todas as operações da ListaOrdenadaEsparsa (Packed Memory Array)
+ */
+void medirListaOrdenadaEsparsa(Cenario &cenario)
+{
+    std::string nome = "ListaOrdenadaEsparsa";
+    ListaOrdenadaEsparsa lista;
+    std::vector<Elemento *> elementos;
+    elementos.reserve(cenario.tamanho);
+    for (int id : cenario.ids)
+    {
+        elementos.push_back(novoProduto(id));
+    }
+    lista.inserirVarios(elementos.data(), elementos.size());
+
+    medirInsercao(
+        cenario, "inserir (ordenado)", nome, [&](Elemento *elemento)
+        { lista.inserirNoFinal(elemento); },
+        [&](Elemento *elemento)
+        { return lista.removerPeloId(elemento->getID()); });
+    medirRemocao(
+        cenario, "removerPrimeiro", nome, [&](int)
+        { return lista.removerPrimeiro(); },
+        [&](Elemento *elemento)
+        { lista.inserirNoInicio(elemento); });
+    medirRemocao(
+        cenario, "removerUltimo", nome, [&](int)
+        { return lista.removerUltimo(); },
+        [&](Elemento *elemento)
+        { lista.inserirNoFinal(elemento); });
+    medirOperacoesPorId(cenario, nome, lista, [&](Elemento *elemento)
+                        { lista.inserirNoFinal(elemento); });
+    medirPercursos(cenario, nome, lista);
+}
+
+/**
+ * Mede todas as operações da ListaSequencial<Produto> (armazenamento por valor)
+ */
+void medirListaSequencial(Cenario &cenario)
+{
+    std::string nome = "ListaSequencial<Produto>";
+    ListaSequencial<Produto> lista(cenario.tamanho);
+    for (int id : cenario.ids)
+    {
+        lista.construirNoFinal(id, "Produto", 1.0, 1);
+    }
+    Produto exemplo(-1, "Produto", 1.0, 1);
+    int pendentes = 0;
+
+    cenario.medicoes.push_back(medir(
+        "inserirNoInicio", nome,
+        [&](int)
+        {
+            for (; pendentes > 0; pendentes--)
+            {
+                lista.removerPrimeiro();
+            }
+        },
+        [&](int lote)
+        {
+            for (int i = 0; i < lote; i++)
+            {
+                lista.inserirNoInicio(exemplo);
+            }
+            pendentes = lote;
+        },
+        loteAlterando(cenario)));
+    cenario.medicoes.push_back(medir(
+        "inserirNoFinal", nome,
+        [&](int)
+        {
+            for (; pendentes > 0; pendentes--)
+            {
+                lista.removerUltimo();
+            }
+        },
+        [&](int lote)
+        {
+            for (int i = 0; i < lote; i++)
+            {
+                lista.inserirNoFinal(exemplo);
+            }
+            pendentes = lote;
+        },
+        loteAlterando(cenario)));
+
+    std::vector<Produto> removidos(loteAlterando(cenario), exemplo);
+    cenario.medicoes.push_back(medir(
+        "removerUltimo", nome,
+        [&](int)
+        {
+            for (; pendentes > 0; pendentes--)
+            {
+                lista.inserirNoFinal(removidos[pendentes - 1]);
+            }
+        },
+        [&](int lote)
+        {
+            for (int i = 0; i < lote; i++)
+            {
+                lista.removerUltimo(&removidos[i]);
+            }
+            pendentes = lote;
+        },
+        loteAlterando(cenario)));
+
+    medirConsulta(cenario, "buscarPeloId (acerto)", nome, [&](int i)
+                  { sumidouro += lista.buscarPeloId(idPresente(cenario, i)) != nullptr; });
+    medirConsulta(cenario, "buscarPeloId (falha)", nome, [&](int i)
+                  { sumidouro += lista.buscarPeloId(idAusente(cenario, i)) != nullptr; });
+    medirPercurso(cenario, "percorrer (iterador)", nome, [&]()
+                  {
+                      for (const Produto &produto : lista)
+                      {
+                          sumidouro += produto.getID();
+                      } });
+    medirPercurso(cenario, "percorrer (paraCada)", nome, [&]()
+                  { lista.paraCada([](const Produto &produto)
+                                   { sumidouro += produto.getID(); }); });
+}
+
+/**
+ * Mede todas as operações de uma das listas encadeadas
+ * (todas têm a mesma interface de inserção, remoção e busca)
+ */
+template <typename Lista>
+void medirListaEncadeada(Cenario &cenario, const std::string &nome)
+{
+    Lista lista;
+    for (int id : cenario.ids)
+    {
+        lista.inserirNoInicio(novoProduto(id));
+    }
+
+    medirInsercao(
+        cenario, "inserirNoInicio", nome, [&](Elemento *elemento)
+        { lista.inserirNoInicio(elemento); },
+        [&](Elemento *)
+        { return lista.removerPrimeiro(); });
+    medirInsercao(
+        cenario, "inserirNoFinal", nome, [&](Elemento *elemento)
+        { lista.inserirNoFim(elemento); },
+        [&](Elemento *)
+        { return lista.removerUltimo(); });
+    medirRemocao(
+        cenario, "removerPrimeiro", nome, [&](int)
+        { return lista.removerPrimeiro(); },
+        [&](Elemento *elemento)
+        { lista.inserirNoInicio(elemento); });
+    medirRemocao(
+        cenario, "removerUltimo", nome, [&](int)
+        { return lista.removerUltimo(); },
+        [&](Elemento *elemento)
+        { lista.inserirNoFim(elemento); });
+    medirOperacoesPorId(cenario, nome, lista, [&](Elemento *elemento)
+                        { lista.inserirNoInicio(elemento); });
+    medirPercursos(cenario, nome, lista);
+
+    esvaziar([&]()
+             { return lista.removerPrimeiro(); });
+}
+
+/**
+ * Mede todas as operações da Árvore Binária de Busca
+ * (os IDs são inseridos em ordem aleatória, o que mantém a altura logarítmica)
+ */
+void medirArvore(Cenario &cenario)
+{
+    std::string nome = "ArvoreBinariaBusca";
+    ArvoreBinariaBusca arvore;
+    for (int id : cenario.ids)
+    {
+        arvore.inserir(novoProduto(id));
+    }
+
+    medirInsercao(
+        cenario, "inserir (ordenado)", nome, [&](Elemento *elemento)
+        { arvore.inserir(elemento); },
+        [&](Elemento *elemento)
+        { return arvore.removerPeloId(elemento->getID()); });
+    medirOperacoesPorId(cenario, nome, arvore, [&](Elemento *elemento)
+                        { arvore.inserir(elemento); });
+    medirPercursos(cenario, nome, arvore);
+}
+
+/**
+ * Mede as operações de uma pilha (Pilha ou PilhaEncadeada)
+ */
+template <typename TipoPilha>
+void medirPilha(Cenario &cenario, const std::string &nome)
+{
+    TipoPilha pilha;
+    for (int id : cenario.ids)
+    {
+        pilha.empilhar(novoProduto(id));
+    }
+
+    medirInsercao(
+        cenario, "empilhar / enfileirar", nome, [&](Elemento *elemento)
+        { pilha.empilhar(elemento); },
+        [&](Elemento *)
+        { return pilha.desempilhar(); });
+    medirRemocao(
+        cenario, "desempilhar / desenfileirar", nome, [&](int)
+        { return pilha.desempilhar(); },
+        [&](Elemento *elemento)
+        { pilha.empilhar(elemento); });
+    medirConsulta(cenario, "consultar topo / frente", nome, [&](int)
+                  { sumidouro += pilha.consultarTopo() != nullptr; });
+
+    esvaziar([&]()
+             { return pilha.desempilhar(); });
+}
+
+/**
+ * Mede as operações de uma fila (Fila, FilaOtimizada ou FilaEncadeada)
+ * Filas que recusam inserções antes de atingir o tamanho medido são registradas
+ * sem amostras
+ */
+template <typename TipoFila>
+void medirFila(Cenario &cenario, const std::string &nome)
+{
+    TipoFila fila;
+
+    // Enfileira também a folga usada pelos lotes de inserção, para detectar
+    // capacidade insuficiente antes de medir; a folga é retirada em seguida
+    int total = cenario.tamanho + loteAlterando(cenario);
+    for (int i = 0; i < total; i++)
+    {
+        Elemento *elemento = novoProduto(i < cenario.tamanho ? cenario.ids[i] : -1);
+        if (!fila.enfileirar(elemento))
+        {
+            delete elemento;
+            esvaziar([&]()
+                     { return fila.desenfileirar(); });
+            Medicao semEspaco = {"empilhar / enfileirar", nome + " (sem capacidade)", 0, 0, 0};
+            cenario.medicoes.push_back(semEspaco);
+            return;
+        }
+    }
+    for (int i = cenario.tamanho; i < total; i++)
+    {
+        delete fila.desenfileirar();
+    }
+
+    medirInsercao(
+        cenario, "empilhar / enfileirar", nome, [&](Elemento *elemento)
+        { fila.enfileirar(elemento); },
+        [&](Elemento *)
+        { return fila.desenfileirar(); });
+    medirRemocao(
+        cenario, "desempilhar / desenfileirar", nome, [&](int)
+        { return fila.desenfileirar(); },
+        [&](Elemento *elemento)
+        { fila.enfileirar(elemento); });
+    medirConsulta(cenario, "consultar topo / frente", nome, [&](int)
+                  { sumidouro += fila.consultarFrente() != nullptr; });
+
+    esvaziar([&]()
+             { return fila.desenfileirar(); });
+}
+
+/**
+ * Mede todas as operações do Deque
+ */
+void medirDeque(Cenario &cenario)
+{
+    std::string nome = "Deque";
+    Deque deque;
+    for (int id : cenario.ids)
+    {
+        deque.inserirTras(novoProduto(id));
+    }
+
+    medirInsercao(
+        cenario, "inserirNoInicio", nome, [&](Elemento *elemento)
+        { deque.inserirFrente(elemento); },
+        [&](Elemento *)
+        { return deque.removerFrente(); });
+    medirInsercao(
+        cenario, "inserirNoFinal", nome, [&](Elemento *elemento)
+        { deque.inserirTras(elemento); },
+        [&](Elemento *)
+        { return deque.removerTras(); });
+    medirRemocao(
+        cenario, "removerPrimeiro", nome, [&](int)
+        { return deque.removerFrente(); },
+        [&](Elemento *elemento)
+        { deque.inserirFrente(elemento); });
+    medirRemocao(
+        cenario, "removerUltimo", nome, [&](int)
+        { return deque.removerTras(); },
+        [&](Elemento *elemento)
+        { deque.inserirTras(elemento); });
+    medirConsulta(cenario, "consultar topo / frente", nome, [&](int)
+                  { sumidouro += deque.consultarFrente() != nullptr; });
+    medirPercursos(cenario, nome, deque);
+
+    esvaziar([&]()
+             { return deque.removerFrente(); });
+}
+
+/**
+ * Cria o cenário de um tamanho: IDs pares em ordem aleatória, buscas por IDs
+ * presentes sorteados e por IDs ímpares (ausentes)
+ */
+Cenario criarCenario(int tamanho)
+{
+    Cenario cenario;
+    cenario.tamanho = tamanho;
+    cenario.ids.resize(tamanho);
+    for (int i = 0; i < tamanho; i++)
+    {
+        cenario.ids[i] = 2 * i;
+    }
+    std::mt19937 gerador(2025);
+    std::shuffle(cenario.ids.begin(), cenario.ids.end(), gerador);
+
+    // Sequências de tamanho potência de 2, percorridas ciclicamente com máscara;
+    // os primeiros IDs ausentes são distintos (são usados pelas inserções)
+    const int TAMANHO_SEQUENCIA = 1024;
+    cenario.consultas.resize(TAMANHO_SEQUENCIA);
+    cenario.ausentes.resize(TAMANHO_SEQUENCIA);
+    for (int i = 0; i < TAMANHO_SEQUENCIA; i++)
+    {
+        cenario.consultas[i] = cenario.ids[gerador() % tamanho];
+        cenario.ausentes[i] = cenario.ids[i % tamanho] + 1;
+    }
+    return cenario;
+}
+
+/**
+ * Imprime as medições de um tamanho, agrupadas por operação, para comparar
+ * as estruturas lado a lado
+ */
+void imprimirMedicoes(const Cenario &cenario)
+{
+    static const char *const ORDEM[] = {
+        "inserirNoInicio", "inserirNoFinal", "inserir (ordenado)", "removerPrimeiro", "removerUltimo",
+        "removerPeloId", "buscarPeloId (acerto)", "buscarPeloId (falha)",
+        "empilhar / enfileirar", "desempilhar / desenfileirar", "consultar topo / frente",
+        "percorrer (iterador)", "percorrer (paraCada)"};
+
+    imprimirSeparador("n = " + std::to_string(cenario.tamanho));
+    std::cout << std::left << std::setw(30) << "estrutura" << std::right
+              << std::setw(14) << "mediana (ns)" << std::setw(14) << "p99 (ns)" << std::setw(10) << "amostras" << std::endl;
+
+    for (const char *operacao : ORDEM)
+    {
+        bool cabecalho = false;
+        for (const Medicao &medicao : cenario.medicoes)
+        {
+            if (medicao.operacao != operacao)
+            {
+                continue;
+            }
+            if (!cabecalho)
+            {
+                std::cout << "\n"
+                          << operacao << (medicao.operacao.compare(0, 9, "percorrer") == 0 ? " - por elemento" : "") << std::endl;
+                cabecalho = true;
+            }
+            std::cout << "  " << std::left << std::setw(28) << medicao.estrutura << std::right;
+            if (medicao.amostras == 0)
+            {
+                std::cout << std::setw(14) << "-" << std::setw(14) << "-" << std::setw(10) << 0 << std::endl;
+                continue;
+            }
+            std::cout << std::fixed << std::setprecision(1)
+                      << std::setw(14) << medicao.mediana << std::setw(14) << medicao.p99
+                      << std::setw(10) << medicao.amostras << std::endl;
+        }
+    }
+}
+
+/**
+ * Executa a suíte: para cada tamanho (10, 100, ..., tamanhoMaximo), mede cada
+ * operação pública de cada estrutura
+ * @param tamanhoMaximo Maior tamanho medido
+ */
+void executarSuite(int tamanhoMaximo)
+{
+    for (long long tamanho = 10; tamanho <= tamanhoMaximo; tamanho *= 10)
+    {
+        Cenario cenario = criarCenario(static_cast<int>(tamanho));
+
+        medirListaNaoOrdenada(cenario, false);
+        medirListaNaoOrdenada(cenario, true);
+        medirListaOrdenada(cenario);
+        medirListaOrdenadaEsparsa(cenario);
+        medirListaSequencial(cenario);
+        medirListaEncadeada<ListaSimplesmenteEncadeada>(cenario, "ListaSimplesmenteEncadeada");
+        medirListaEncadeada<ListaDuplamenteEncadeada>(cenario, "ListaDuplamenteEncadeada");
+        medirListaEncadeada<ListaDuplamenteEncadeadaCircular>(cenario, "ListaDuplEncadeadaCircular");
+        medirArvore(cenario);
+        medirDeque(cenario);
+        medirPilha<Pilha>(cenario, "Pilha");
+        medirPilha<PilhaEncadeada>(cenario, "PilhaEncadeada");
+        medirFila<Fila>(cenario, "Fila");
+        medirFila<FilaOtimizada>(cenario, "FilaOtimizada");
+        medirFila<FilaEncadeada>(cenario, "FilaEncadeada");
+
+        imprimirMedicoes(cenario);
+    }
+}
+
+/**
+ * Mede a vazão de inserirNoFinal na ListaNaoOrdenada
+ * O mesmo elemento é inserido repetidamente para medir apenas o custo do array
+ * (sem alocação de objetos); a lista é esvaziada antes de ser destruída.
+ * @param quantidade Número de inserções
+ */
+void medirInsercaoNoFinal(int quantidade)
+{
+    Produto elemento(1, "Elemento de medição", 1.0, 1);
+    ListaNaoOrdenada lista;
+
+    Relogio::time_point inicio = Relogio::now();
+    for (int i = 0; i < quantidade; i++)
+    {
+        lista.inserirNoFinal(&elemento);
+    }
+    Relogio::time_point fim = Relogio::now();
+
+    double segundos = std::chrono::duration<double>(fim - inicio).count();
+    std::cout << std::setw(10) << quantidade
+              << std::setw(14) << std::fixed << std::setprecision(3) << segundos * 1e3 << " ms"
+              << std::setw(12) << std::setprecision(2) << (segundos * 1e9 / quantidade) << " ns/op"
+              << std::setw(14) << std::setprecision(1) << (quantidade / segundos / 1e6) << " Mops/s"
+              << "   capacidade final: " << lista.getCapacidade() << std::endl;
+
+    while (!lista.estaVazia())
+    {
+        lista.removerUltimo();
+    }
+}
+
+/**
+ * Mede uma carga dominada por remoções: remove pelo ID, em ordem aleatória,
+ * todos os elementos de uma ListaNaoOrdenada com índice hash ativo
+ * (o índice isola o custo de fechar o buraco do custo da busca)
+ * @param quantidade Número de elementos
+ * @param politica Política de remoção da lista
+ */
+void medirRemocaoPeloId(int quantidade, ListaNaoOrdenada::PoliticaRemocao politica)
+{
+    ListaNaoOrdenada lista(quantidade, 2.0, politica);
+    lista.ativarIndice();
+
+    std::vector<int> ids(quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        ids[i] = i;
+        lista.inserirNoFinal(new Produto(i, "Produto", 1.0, 1));
+    }
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(12345));
+
+    std::vector<Elemento *> removidos;
+    removidos.reserve(quantidade);
+
+    Relogio::time_point inicio = Relogio::now();
+    for (int i = 0; i < quantidade; i++)
+    {
+        removidos.push_back(lista.removerPeloId(ids[i]));
+    }
+    Relogio::time_point fim = Relogio::now();
+
+    double segundos = std::chrono::duration<double>(fim - inicio).count();
+    std::cout << std::setw(10) << quantidade
+              << std::setw(20) << (politica == ListaNaoOrdenada::PRESERVAR_ORDEM ? "PRESERVAR_ORDEM" : "TROCAR_COM_ULTIMO")
+              << std::setw(14) << std::fixed << std::setprecision(3) << segundos * 1e3 << " ms"
+              << std::setw(12) << std::setprecision(2) << (segundos * 1e9 / quantidade) << " ns/op" << std::endl;
+
+    for (Elemento *elemento : removidos)
+    {
+        delete elemento;
+    }
+}
+
+/**
+ * Mede a busca linear pelo ID (sem índice hash) em uma ListaNaoOrdenada,
+ * buscando IDs ausentes para que cada busca percorra a lista inteira
+ * @param quantidade Número de elementos
+ */
+void medirBuscaLinear(int quantidade)
+{
+    ListaNaoOrdenada lista(quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        lista.inserirNoFinal(new Produto(i, "Produto", 1.0, 1));
+    }
+
+    int buscas = 100000000 / quantidade + 1;
+    int encontrados = 0;
+
+    Relogio::time_point inicio = Relogio::now();
+    for (int i = 0; i < buscas; i++)
+    {
+        encontrados += lista.buscarPeloId(-1 - i) != nullptr;
+    }
+    Relogio::time_point fim = Relogio::now();
+
+    double segundos = std::chrono::duration<double>(fim - inicio).count();
+    std::cout << std::setw(10) << quantidade
+              << std::setw(14) << std::fixed << std::setprecision(1) << (segundos * 1e9 / buscas) << " ns/busca"
+              << std::setw(12) << std::setprecision(3) << (segundos * 1e9 / buscas / quantidade) << " ns/elemento"
+              << (encontrados != 0 ? "  (erro: ID ausente encontrado)" : "") << std::endl;
+}
+
+/**
+ * Compara a carga de uma ListaOrdenada com IDs aleatórios elemento a elemento
+ * (um deslocamento O(n) por inserção) com a carga em lote (inserirVarios)
+ * @param quantidade Número de elementos
+ * @param individual Se deve medir também a inserção elemento a elemento
+ */
+void medirCargaOrdenada(int quantidade, bool individual)
+{
+    std::vector<int> ids(quantidade);
+    std::mt19937 gerador(54321);
+    for (int i = 0; i < quantidade; i++)
+    {
+        ids[i] = static_cast<int>(gerador() % 1000000000);
+    }
+
+    // As listas são donas dos elementos: cada uma recebe os seus
+    std::vector<Elemento *> lote(quantidade);
+    std::cout << std::setw(10) << quantidade;
+
+    if (individual)
+    {
+        for (int i = 0; i < quantidade; i++)
+        {
+            lote[i] = new Produto(ids[i], "Produto", 1.0, 1);
+        }
+        ListaOrdenada lista;
+        Relogio::time_point inicio = Relogio::now();
+        for (int i = 0; i < quantidade; i++)
+        {
+            lista.inserirNoFinal(lote[i]);
+        }
+        Relogio::time_point fim = Relogio::now();
+        std::cout << std::setw(14) << std::fixed << std::setprecision(3)
+                  << std::chrono::duration<double>(fim - inicio).count() * 1e3 << " ms";
+    }
+    else
+    {
+        std::cout << std::setw(17) << "-";
+    }
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        lote[i] = new Produto(ids[i], "Produto", 1.0, 1);
+    }
+    ListaOrdenada lista;
+    Relogio::time_point inicio = Relogio::now();
+    lista.inserirVarios(lote.data(), lote.size());
+    Relogio::time_point fim = Relogio::now();
+    std::cout << std::setw(14) << std::fixed << std::setprecision(3)
+              << std::chrono::duration<double>(fim - inicio).count() * 1e3 << " ms" << std::endl;
+}
+
+/**
+ * Mede n inserções individuais com IDs aleatórios em uma ListaOrdenada sem e
+ * com o buffer de escrita, e depois n buscas (acertos) na lista com buffer,
+ * que ainda pode ter inserções pendentes
+ * @param quantidade Número de elementos
+ * @param semBuffer Se deve medir também a inserção sem buffer
+ */
+void medirBufferEscrita(int quantidade, bool semBuffer)
+{
+    std::vector<int> ids(quantidade);
+    std::mt19937 gerador(13579);
+    for (int i = 0; i < quantidade; i++)
+    {
+        ids[i] = static_cast<int>(gerador() % 1000000000);
+    }
+
+    std::cout << std::setw(10) << quantidade;
+    if (semBuffer)
+    {
+        ListaOrdenada lista;
+        Relogio::time_point inicio = Relogio::now();
+        for (int i = 0; i < quantidade; i++)
+        {
+            lista.inserirNoFinal(new Produto(ids[i], "Produto", 1.0, 1));
+        }
+        Relogio::time_point fim = Relogio::now();
+        std::cout << std::setw(14) << std::fixed << std::setprecision(1)
+                  << std::chrono::duration<double>(fim - inicio).count() * 1e9 / quantidade << " ns/op";
+    }
+    else
+    {
+        std::cout << std::setw(20) << "-";
+    }
+
+    ListaOrdenada lista;
+    lista.ativarBufferEscrita();
+    Relogio::time_point inicio = Relogio::now();
+    for (int i = 0; i < quantidade; i++)
+    {
+        lista.inserirNoFinal(new Produto(ids[i], "Produto", 1.0, 1));
+    }
+    Relogio::time_point meio = Relogio::now();
+    int encontrados = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        encontrados += lista.buscarPeloId(ids[i]) != nullptr;
+    }
+    Relogio::time_point fim = Relogio::now();
+
+    std::cout << std::setw(14) << std::fixed << std::setprecision(1)
+              << std::chrono::duration<double>(meio - inicio).count() * 1e9 / quantidade << " ns/op"
+              << std::setw(14) << std::chrono::duration<double>(fim - meio).count() * 1e9 / quantidade << " ns/op"
+              << (encontrados != quantidade ? "  (erro: ID inserido não encontrado)" : "") << std::endl;
+}
+
+/**
+ * Mede n inserções individuais com IDs aleatórios seguidas de n remoções pelo
+ * ID, em ordem aleatória, em uma lista ordenada
+ * @param quantidade Número de elementos
+ * @return Tempos médios por inserção e por remoção, em ns
+ */
+template <typename Lista>
+std::pair<double, double> medirInsercaoRemocaoOrdenada(int quantidade)
+{
+    std::vector<int> ids(quantidade);
+    std::mt19937 gerador(24680);
+    for (int i = 0; i < quantidade; i++)
+    {
+        ids[i] = static_cast<int>(gerador() % 1000000000);
+    }
+    std::vector<int> ordemRemocao(ids);
+    std::shuffle(ordemRemocao.begin(), ordemRemocao.end(), gerador);
+
+    Lista lista;
+    Relogio::time_point inicio = Relogio::now();
+    for (int i = 0; i < quantidade; i++)
+    {
+        lista.inserirNoFinal(new Produto(ids[i], "Produto", 1.0, 1));
+    }
+    Relogio::time_point meio = Relogio::now();
+    for (int i = 0; i < quantidade; i++)
+    {
+        delete lista.removerPeloId(ordemRemocao[i]);
+    }
+    Relogio::time_point fim = Relogio::now();
+
+    return std::make_pair(std::chrono::duration<double>(meio - inicio).count() * 1e9 / quantidade,
+                          std::chrono::duration<double>(fim - meio).count() * 1e9 / quantidade);
+}
+
+/**
+ * Compara inserções e remoções individuais na ListaOrdenada (deslocamento
+ * O(n)) e na ListaOrdenadaEsparsa (redistribuição O(log² n) amortizada)
+ * @param quantidade Número de elementos
+ * @param listaOrdenada Se deve medir também a ListaOrdenada
+ */
+void medirListaEsparsa(int quantidade, bool listaOrdenada)
+{
+    std::cout << std::setw(10) << quantidade << std::fixed << std::setprecision(1);
+    if (listaOrdenada)
+    {
+        std::pair<double, double> tempos = medirInsercaoRemocaoOrdenada<ListaOrdenada>(quantidade);
+        std::cout << std::setw(14) << tempos.first << " ns/op" << std::setw(14) << tempos.second << " ns/op";
+    }
+    else
+    {
+        std::cout << std::setw(20) << "-" << std::setw(20) << "-";
+    }
+
+    std::pair<double, double> tempos = medirInsercaoRemocaoOrdenada<ListaOrdenadaEsparsa>(quantidade);
+    std::cout << std::setw(14) << tempos.first << " ns/op" << std::setw(14) << tempos.second << " ns/op" << std::endl;
+}
+
+/**
+ * Mede a atualização de uma ListaOrdenada de n elementos com um lote de n/10
+ * elementos novos: inserção elemento a elemento, mesclar com o lote fora de
+ * ordem e mesclar com o lote já ordenado (a ordenação é dispensada)
+ * @param quantidade Número de elementos já presentes na lista
+ * @param individual Se deve medir também a inserção elemento a elemento
+ */
+void medirMesclagem(int quantidade, bool individual)
+{
+    int tamanhoLote = quantidade / 10;
+    std::mt19937 gerador(2468);
+    std::vector<int> idsExistentes(quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        idsExistentes[i] = static_cast<int>(gerador() % 1000000000);
+    }
+    std::vector<int> idsLote(tamanhoLote);
+    for (int i = 0; i < tamanhoLote; i++)
+    {
+        idsLote[i] = static_cast<int>(gerador() % 1000000000);
+    }
+
+    std::cout << std::setw(10) << quantidade;
+    for (int variante = 0; variante < 3; variante++)
+    {
+        if (variante == 0 && !individual)
+        {
+            std::cout << std::setw(17) << "-";
+            continue;
+        }
+        if (variante == 2)
+        {
+            std::sort(idsLote.begin(), idsLote.end());
+        }
+
+        // As listas são donas dos elementos: cada variante recebe os seus
+        std::vector<Elemento *> existentes(quantidade);
+        for (int i = 0; i < quantidade; i++)
+        {
+            existentes[i] = new Produto(idsExistentes[i], "Produto", 1.0, 1);
+        }
+        ListaOrdenada lista;
+        lista.inserirVarios(existentes.data(), existentes.size());
+
+        std::vector<Elemento *> lote(tamanhoLote);
+        for (int i = 0; i < tamanhoLote; i++)
+        {
+            lote[i] = new Produto(idsLote[i], "Produto", 1.0, 1);
+        }
+
+        Relogio::time_point inicio = Relogio::now();
+        if (variante == 0)
+        {
+            for (Elemento *elemento : lote)
+            {
+                lista.inserirNoFinal(elemento);
+            }
+        }
+        else
+        {
+            lista.mesclar(lote.data(), lote.size());
+        }
+        Relogio::time_point fim = Relogio::now();
+        std::cout << std::setw(14) << std::fixed << std::setprecision(3)
+                  << std::chrono::duration<double>(fim - inicio).count() * 1e3 << " ms";
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * Mede a consulta dos elementos com ID em um intervalo que contém 100 deles:
+ * na ListaOrdenada, com 100 buscas pelo ID e com buscarIntervalo (visão do
+ * array); na ArvoreBinariaBusca, com buscarIntervalo (descida podada)
+ * @param quantidade Número de elementos
+ */
+void medirBuscaIntervalo(int quantidade)
+{
+    const int largura = 100;
+    std::vector<int> ordem(quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        ordem[i] = i;
+    }
+    // Insere na árvore em ordem aleatória, para que ela não degenere em lista
+    std::shuffle(ordem.begin(), ordem.end(), std::mt19937(8642));
+
+    std::vector<Elemento *> lote(quantidade);
+    ArvoreBinariaBusca arvore;
+    for (int i = 0; i < quantidade; i++)
+    {
+        lote[i] = new Produto(ordem[i], "Produto", 1.0, 1);
+        arvore.inserir(new Produto(ordem[i], "Produto", 1.0, 1));
+    }
+    ListaOrdenada lista;
+    lista.inserirVarios(lote.data(), lote.size());
+
+    const int consultas = 100000;
+    std::vector<int> inicios(consultas);
+    std::mt19937 gerador(97531);
+    for (int i = 0; i < consultas; i++)
+    {
+        inicios[i] = static_cast<int>(gerador() % (quantidade - largura + 1));
+    }
+
+    long long somaBuscas = 0;
+    long long somaVisao = 0;
+    long long somaArvore = 0;
+    Relogio::time_point t0 = Relogio::now();
+    for (int i = 0; i < consultas; i++)
+    {
+        for (int id = inicios[i]; id < inicios[i] + largura; id++)
+        {
+            somaBuscas += lista.buscarPeloId(id)->getID();
+        }
+    }
+    Relogio::time_point t1 = Relogio::now();
+    for (int i = 0; i < consultas; i++)
+    {
+        for (Elemento *elemento : lista.buscarIntervalo(inicios[i], inicios[i] + largura - 1))
+        {
+            somaVisao += elemento->getID();
+        }
+    }
+    Relogio::time_point t2 = Relogio::now();
+    for (int i = 0; i < consultas; i++)
+    {
+        arvore.buscarIntervalo(inicios[i], inicios[i] + largura - 1, [&somaArvore](const Elemento *elemento)
+                               { somaArvore += elemento->getID(); });
+    }
+    Relogio::time_point t3 = Relogio::now();
+
+    std::cout << std::setw(10) << quantidade << std::fixed << std::setprecision(1)
+              << std::setw(15) << std::chrono::duration<double>(t1 - t0).count() * 1e9 / consultas << " ns"
+              << std::setw(15) << std::chrono::duration<double>(t2 - t1).count() * 1e9 / consultas << " ns"
+              << std::setw(15) << std::chrono::duration<double>(t3 - t2).count() * 1e9 / consultas << " ns"
+              << (somaBuscas != somaVisao || somaVisao != somaArvore ? "  (erro: resultados diferentes)" : "")
+              << std::endl;
+}
+
+/**
+ * Compara a carga de n produtos em uma ListaNaoOrdenada (um new por elemento)
+ * com a carga em uma ListaSequencial<Produto> (objetos construídos no próprio bloco);
+ * as duas listas reservam a capacidade antes, para medir só o custo por elemento
+ * @param quantidade Número de elementos
+ */
+void medirCargaPorValor(int quantidade)
+{
+    std::cout << std::setw(10) << quantidade;
+
+    {
+        ListaNaoOrdenada lista(quantidade);
+        Relogio::time_point inicio = Relogio::now();
+        for (int i = 0; i < quantidade; i++)
+        {
+            lista.inserirNoFinal(new Produto(i, "Produto", 1.0, i));
+        }
+        Relogio::time_point fim = Relogio::now();
+        std::cout << std::setw(17) << std::fixed << std::setprecision(3)
+                  << std::chrono::duration<double>(fim - inicio).count() * 1e3 << " ms";
+    }
+
+    ListaSequencial<Produto> lista(quantidade);
+    Relogio::time_point inicio = Relogio::now();
+    for (int i = 0; i < quantidade; i++)
+    {
+        lista.construirNoFinal(i, "Produto", 1.0, i);
+    }
+    Relogio::time_point fim = Relogio::now();
+    std::cout << std::setw(17) << std::fixed << std::setprecision(3)
+              << std::chrono::duration<double>(fim - inicio).count() * 1e3 << " ms" << std::endl;
+}
+
+/**
+ * Compara a soma das quantidades de n produtos percorrendo uma ListaNaoOrdenada
+ * (um ponteiro por elemento, objetos espalhados pelo heap) e uma
+ * ListaSequencial<Produto> (objetos contíguos), ambas com iteradores
+ * @param quantidade Número de elementos
+ */
+void medirVarredura(int quantidade)
+{
+    // Aloca os produtos em ordem aleatória, como após muitas inserções e remoções
+    std::vector<int> ordem(quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        ordem[i] = i;
+    }
+    std::shuffle(ordem.begin(), ordem.end(), std::mt19937(777));
+    std::vector<Produto *> produtos(quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        produtos[ordem[i]] = new Produto(ordem[i], "Produto", 1.0, ordem[i] % 7);
+    }
+
+    ListaNaoOrdenada porPonteiro(quantidade);
+    ListaSequencial<Produto> porValor(quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        porPonteiro.inserirNoFinal(produtos[i]);
+        porValor.inserirNoFinal(*produtos[i]);
+    }
+
+    int repeticoes = 100000000 / quantidade + 1;
+    long long somaPonteiro = 0;
+    long long somaValor = 0;
+
+    Relogio::time_point inicio = Relogio::now();
+    for (int r = 0; r < repeticoes; r++)
+    {
+        for (Elemento *elemento : porPonteiro)
+        {
+            somaPonteiro += static_cast<const Produto *>(elemento)->getQuantidade();
+        }
+    }
+    Relogio::time_point meio = Relogio::now();
+    for (int r = 0; r < repeticoes; r++)
+    {
+        for (const Produto &produto : porValor)
+        {
+            somaValor += produto.getQuantidade();
+        }
+    }
+    Relogio::time_point fim = Relogio::now();
+
+    double elementos = static_cast<double>(repeticoes) * quantidade;
+    std::cout << std::setw(10) << quantidade
+              << std::setw(14) << std::fixed << std::setprecision(3)
+              << std::chrono::duration<double>(meio - inicio).count() * 1e9 / elementos << " ns/elem"
+              << std::setw(14) << std::chrono::duration<double>(fim - meio).count() * 1e9 / elementos << " ns/elem"
+              << (somaPonteiro != somaValor ? "  (erro: somas diferentes)" : "") << std::endl;
+}
+
+/**
+ * Compara a busca binária da ListaOrdenada (um ponteiro desreferenciado por
+ * passo) com a busca no retrato congelado (layout de Eytzinger com prefetch)
+ * e com o índice k-ário ativo, para IDs presentes consultados em ordem aleatória
+ * A construção do índice k-ário (feita ao ativá-lo) não entra na medição
+ * @param quantidade Número de elementos
+ */
+void medirBuscaCongelada(int quantidade)
+{
+    std::vector<Elemento *> lote(quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        lote[i] = new Produto(2 * i, "Produto", 1.0, 1);
+    }
+    ListaOrdenada lista;
+    lista.inserirVarios(lote.data(), lote.size());
+    std::unique_ptr<ListaOrdenadaCongelada> retrato(lista.congelar());
+
+    const int buscas = 4000000;
+    std::vector<int> consultas(buscas);
+    std::mt19937 gerador(31337);
+    for (int i = 0; i < buscas; i++)
+    {
+        consultas[i] = 2 * static_cast<int>(gerador() % quantidade);
+    }
+
+    int encontradosLista = 0;
+    int encontradosRetrato = 0;
+    Relogio::time_point inicio = Relogio::now();
+    for (int i = 0; i < buscas; i++)
+    {
+        encontradosLista += lista.buscarPeloId(consultas[i]) != nullptr;
+    }
+    Relogio::time_point meio = Relogio::now();
+    for (int i = 0; i < buscas; i++)
+    {
+        encontradosRetrato += retrato->buscarPeloId(consultas[i]) != nullptr;
+    }
+    Relogio::time_point fim = Relogio::now();
+
+    lista.ativarIndiceKario();
+    int encontradosKario = 0;
+    Relogio::time_point inicioKario = Relogio::now();
+    for (int i = 0; i < buscas; i++)
+    {
+        encontradosKario += lista.buscarPeloId(consultas[i]) != nullptr;
+    }
+    Relogio::time_point fimKario = Relogio::now();
+
+    std::cout << std::setw(10) << quantidade
+              << std::setw(14) << std::fixed << std::setprecision(1)
+              << std::chrono::duration<double>(meio - inicio).count() * 1e9 / buscas << " ns/busca"
+              << std::setw(14) << std::chrono::duration<double>(fim - meio).count() * 1e9 / buscas << " ns/busca"
+              << std::setw(14) << std::chrono::duration<double>(fimKario - inicioKario).count() * 1e9 / buscas << " ns/busca"
+              << (encontradosLista != buscas || encontradosRetrato != buscas || encontradosKario != buscas
+                      ? "  (erro: ID presente não encontrado)"
+                      : "")
+              << std::endl;
+}
+
+/**
+ * Compara a busca binária com o índice aprendido em uma ListaOrdenada de IDs
+ * quase sequenciais (cerca de 0,1% dos IDs é seguido de um salto de até 1000)
+ * A construção do índice (feita ao ativá-lo) é medida à parte
+ * @param quantidade Número de elementos
+ */
+void medirIndiceAprendido(int quantidade)
+{
+    std::vector<Elemento *> lote(quantidade);
+    std::vector<int> ids(quantidade);
+    std::mt19937 gerador(4242);
+    int id = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        id += 1 + (gerador() % 1000 == 0 ? static_cast<int>(gerador() % 1000) : 0);
+        ids[i] = id;
+        lote[i] = new Produto(id, "Produto", 1.0, 1);
+    }
+    ListaOrdenada lista;
+    lista.inserirVarios(lote.data(), lote.size());
+
+    const int buscas = 4000000;
+    std::vector<int> consultas(buscas);
+    for (int i = 0; i < buscas; i++)
+    {
+        consultas[i] = ids[gerador() % quantidade];
+    }
+
+    int encontradosBinaria = 0;
+    Relogio::time_point inicio = Relogio::now();
+    for (int i = 0; i < buscas; i++)
+    {
+        encontradosBinaria += lista.buscarPeloId(consultas[i]) != nullptr;
+    }
+    Relogio::time_point fim = Relogio::now();
+    double binaria = std::chrono::duration<double>(fim - inicio).count() * 1e9 / buscas;
+
+    inicio = Relogio::now();
+    lista.ativarIndiceAprendido();
+    fim = Relogio::now();
+    int trechos = lista.getTrechosIndice();
+    double construcao = std::chrono::duration<double, std::milli>(fim - inicio).count();
+
+    int encontradosIndice = 0;
+    inicio = Relogio::now();
+    for (int i = 0; i < buscas; i++)
+    {
+        encontradosIndice += lista.buscarPeloId(consultas[i]) != nullptr;
+    }
+    fim = Relogio::now();
+    double aprendido = std::chrono::duration<double>(fim - inicio).count() * 1e9 / buscas;
+
+    std::cout << std::setw(10) << quantidade << std::fixed << std::setprecision(1)
+              << std::setw(14) << binaria << " ns/busca"
+              << std::setw(14) << aprendido << " ns/busca"
+              << std::setw(10) << trechos
+              << std::setw(12) << std::setprecision(3) << construcao << " ms"
+              << (encontradosBinaria != buscas || encontradosIndice != buscas ? "  (erro: ID presente não encontrado)" : "")
+              << std::endl;
+}
+
+/**
+ * Mede a interseção de duas listas ordenadas: percorrendo a menor e chamando
+ * buscarPeloId na maior, e com ListaOrdenada::intersecao (só os arrays de IDs)
+ * @param menor Número de elementos da lista percorrida
+ * @param maior Número de elementos da outra lista
+ * @return Tempos em ms (busca a busca, intersecao)
+ */
+std::pair<double, double> medirIntersecao(int menor, int maior)
+{
+    // IDs pares e múltiplos de 3: cerca de um terço da lista menor está na maior
+    std::vector<Elemento *> loteMenor(menor);
+    std::vector<Elemento *> loteMaior(maior);
+    std::mt19937 gerador(777);
+    for (int i = 0; i < menor; i++)
+    {
+        loteMenor[i] = new Produto(2 * static_cast<int>(gerador() % (3 * static_cast<unsigned>(maior))), "Produto", 1.0, 1);
+    }
+    for (int i = 0; i < maior; i++)
+    {
+        loteMaior[i] = new Produto(3 * i, "Produto", 1.0, 1);
+    }
+    ListaOrdenada listaMenor;
+    ListaOrdenada listaMaior;
+    listaMenor.inserirVarios(loteMenor.data(), loteMenor.size());
+    listaMaior.inserirVarios(loteMaior.data(), loteMaior.size());
+
+    std::vector<Elemento *> resultado;
+    resultado.reserve(menor);
+    Relogio::time_point inicio = Relogio::now();
+    for (Elemento *elemento : listaMenor)
+    {
+        if (listaMaior.buscarPeloId(elemento->getID()) != nullptr)
+        {
+            resultado.push_back(elemento);
+        }
+    }
+    Relogio::time_point meio = Relogio::now();
+    size_t encontradosBusca = resultado.size();
+    resultado.clear();
+    listaMenor.intersecao(listaMaior, &resultado);
+    Relogio::time_point fim = Relogio::now();
+
+    if (resultado.size() != encontradosBusca)
+    {
+        std::cout << "  (erro: interseções diferentes)";
+    }
+    return std::make_pair(std::chrono::duration<double, std::milli>(meio - inicio).count(),
+                          std::chrono::duration<double, std::milli>(fim - meio).count());
+}
+
+/**
+ * Compara as duas formas de interseção com listas de mesmo tamanho e com uma
+ * lista mil vezes menor (em que intersecao galopa na maior)
+ * @param quantidade Número de elementos da lista maior
+ */
+void medirOperacoesConjunto(int quantidade)
+{
+    std::cout << std::setw(10) << quantidade;
+    std::pair<double, double> iguais = medirIntersecao(quantidade, quantidade);
+    std::pair<double, double> desiguais = medirIntersecao(quantidade / 1000, quantidade);
+    std::cout << std::fixed << std::setprecision(3)
+              << std::setw(14) << iguais.first << " ms" << std::setw(14) << iguais.second << " ms"
+              << std::setw(14) << desiguais.first << " ms" << std::setw(14) << desiguais.second << " ms"
+              << std::endl;
+}
+
+/**
+ * Passa "quantidade" elementos de uma thread produtora para a thread atual,
+ * que os consome e confere a ordem. Quando a fila está cheia (ou vazia), a
+ * thread cede o processador em vez de girar
+ * @param enfileirar Tentativa de enfileirar (false se a fila está cheia)
+ * @param desenfileirar Tentativa de desenfileirar (nullptr se a fila está vazia)
+ * @return Tempo médio por elemento em ns, ou -1 se a ordem FIFO não foi respeitada
+ */
+template <typename Enfileirar, typename Desenfileirar>
+double medirProdutorConsumidor(int quantidade, const std::vector<Elemento *> &lote,
+                               Enfileirar enfileirar, Desenfileirar desenfileirar)
+{
+    Relogio::time_point inicio = Relogio::now();
+    std::thread produtor([&]()
+                         {
+        for (int i = 0; i < quantidade; i++)
+        {
+            while (!enfileirar(lote[i % lote.size()]))
+            {
+                std::this_thread::yield();
+            }
+        } });
+
+    bool ordemCorreta = true;
+    for (int i = 0; i < quantidade; i++)
+    {
+        Elemento *elemento;
+        while ((elemento = desenfileirar()) == nullptr)
+        {
+            std::this_thread::yield();
+        }
+        ordemCorreta = ordemCorreta && elemento == lote[i % lote.size()];
+    }
+    produtor.join();
+    Relogio::time_point fim = Relogio::now();
+
+    return ordemCorreta ? std::chrono::duration<double>(fim - inicio).count() * 1e9 / quantidade : -1.0;
+}
+
+/**
+ * Compara três formas de um estágio de pipeline consumir o que outra thread
+ * produz: consultar em laço uma FilaEncadeada protegida por um mutex, e
+ * dormir na FilaBloqueante até haver elementos, retirando um por despertar
+ * (desenfileirar) ou até 64 (desenfileirarLote). Informa também quantas
+ * vezes o laço consultou a fila por elemento recebido e quantos elementos,
+ * em média, cada chamada de desenfileirarLote entregou
+ * @param quantidade Número de elementos transferidos
+ */
+void medirFilaBloqueante(int quantidade)
+{
+    const int tamanhoLote = 64;
+    std::vector<Elemento *> lote(1024);
+    for (size_t i = 0; i < lote.size(); i++)
+    {
+        lote[i] = new Produto(static_cast<int>(i), "Produto", 1.0, 1);
+    }
+    bool ordemCorreta = true;
+
+    // Laço de consulta: o consumidor gira em filaVazia() enquanto não há nada
+    FilaEncadeada filaConsultada;
+    std::mutex mutex;
+    Relogio::time_point inicio = Relogio::now();
+    std::thread produtorConsulta([&]()
+                                 {
+        for (int i = 0; i < quantidade; i++)
+        {
+            std::lock_guard<std::mutex> trava(mutex);
+            filaConsultada.enfileirar(lote[i % lote.size()]);
+        } });
+    long long consultas = 0;
+    for (int recebidos = 0; recebidos < quantidade; consultas++)
+    {
+        std::lock_guard<std::mutex> trava(mutex);
+        if (!filaConsultada.filaVazia())
+        {
+            ordemCorreta = ordemCorreta && filaConsultada.desenfileirar() == lote[recebidos % lote.size()];
+            recebidos++;
+        }
+    }
+    produtorConsulta.join();
+    double tempoConsulta = std::chrono::duration<double>(Relogio::now() - inicio).count() * 1e9 / quantidade;
+
+    // FilaBloqueante, um elemento ou um lote por despertar
+    double tempos[2];
+    long long despertares = 0;
+    for (int variante = 0; variante < 2; variante++)
+    {
+        FilaBloqueante fila;
+        inicio = Relogio::now();
+        std::thread produtor([&]()
+                             {
+            for (int i = 0; i < quantidade; i++)
+            {
+                fila.enfileirar(lote[i % lote.size()]);
+            }
+            fila.encerrar(); });
+
+        int recebidos = 0;
+        if (variante == 0)
+        {
+            Elemento *elemento;
+            while ((elemento = fila.desenfileirar()) != nullptr)
+            {
+                ordemCorreta = ordemCorreta && elemento == lote[recebidos++ % lote.size()];
+            }
+        }
+        else
+        {
+            std::vector<Elemento *> saida;
+            saida.reserve(tamanhoLote);
+            while (fila.desenfileirarLote(saida, tamanhoLote) > 0)
+            {
+                despertares++;
+                for (Elemento *elemento : saida)
+                {
+                    ordemCorreta = ordemCorreta && elemento == lote[recebidos++ % lote.size()];
+                }
+                saida.clear();
+            }
+        }
+        produtor.join();
+        ordemCorreta = ordemCorreta && recebidos == quantidade;
+        tempos[variante] = std::chrono::duration<double>(Relogio::now() - inicio).count() * 1e9 / quantidade;
+    }
+
+    std::cout << std::setw(10) << quantidade
+              << std::setw(14) << std::fixed << std::setprecision(1) << tempoConsulta << " ns/elem"
+              << std::setw(14) << tempos[0] << " ns/elem"
+              << std::setw(14) << tempos[1] << " ns/elem"
+              << std::setw(14) << static_cast<double>(consultas) / quantidade
+              << std::setw(14) << static_cast<double>(quantidade) / std::max(despertares, 1LL)
+              << (ordemCorreta ? "" : "  (erro: ordem FIFO violada)") << std::endl;
+
+    for (Elemento *elemento : lote)
+    {
+        delete elemento;
+    }
+}
+
+/**
+ * Divide "operacoes" pares enfileirar/desenfileirar entre "threads" threads,
+ * cada uma produtora e consumidora ao mesmo tempo (enfileira o seu elemento e
+ * desenfileira o que estiver na frente, de qualquer thread)
+ * @param enfileirar Enfileira esperando enquanto a fila estiver cheia
+ * @param desenfileirar Desenfileira esperando enquanto a fila estiver vazia
+ * @return Tempo médio por par em ns, ou -1 se algum elemento se perdeu ou duplicou
+ */
+template <typename Enfileirar, typename Desenfileirar>
+double medirProdutoresConsumidores(int threads, int operacoes, const std::vector<Elemento *> &lote,
+                                   Enfileirar enfileirar, Desenfileirar desenfileirar)
+{
+    int porThread = operacoes / threads;
+    std::vector<long long> somas(threads, 0);
+    std::vector<std::thread> trabalhadores;
+
+    Relogio::time_point inicio = Relogio::now();
+    for (int t = 0; t < threads; t++)
+    {
+        trabalhadores.emplace_back([&, t]()
+                                   {
+            long long soma = 0;
+            for (int i = 0; i < porThread; i++)
+            {
+                enfileirar(lote[t]);
+                soma += desenfileirar()->getID();
+            }
+            somas[t] = soma; });
+    }
+    for (std::thread &trabalhador : trabalhadores)
+    {
+        trabalhador.join();
+    }
+    Relogio::time_point fim = Relogio::now();
+
+    // Os IDs do lote são 0..threads-1: a soma recebida deve ser a enviada
+    long long recebida = std::accumulate(somas.begin(), somas.end(), 0LL);
+    long long enviada = static_cast<long long>(porThread) * threads * (threads - 1) / 2;
+    double pares = static_cast<double>(porThread) * threads;
+    return recebida == enviada ? std::chrono::duration<double>(fim - inicio).count() * 1e9 / pares : -1.0;
+}
+
+/**
+ * Mede a escalabilidade da FilaMPMC e de uma FilaOtimizada protegida por um
+ * mutex com "threads" threads produtoras e consumidoras
+ * @param threads Número de threads
+ */
+void medirFilaMPMC(int threads)
+{
+    const int operacoes = 2000000;
+    const int capacidade = 1024;
+    std::vector<Elemento *> lote(threads);
+    for (int t = 0; t < threads; t++)
+    {
+        lote[t] = new Produto(t, "Produto", 1.0, 1);
+    }
+
+    FilaMPMC filaSemTravas(capacidade);
+    double tempoSemTravas = medirProdutoresConsumidores(
+        threads, operacoes, lote,
+        [&](Elemento *elemento)
+        { filaSemTravas.enfileirarBloqueando(elemento); },
+        [&]()
+        { return filaSemTravas.desenfileirarBloqueando(); });
+
+    FilaOtimizada filaComMutex(capacidade);
+    std::mutex mutex;
+    double tempoComMutex = medirProdutoresConsumidores(
+        threads, operacoes, lote,
+        [&](Elemento *elemento)
+        {
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> trava(mutex);
+                    if (filaComMutex.getTamanho() < capacidade && filaComMutex.enfileirar(elemento))
+                    {
+                        return;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        },
+        [&]()
+        {
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> trava(mutex);
+                    Elemento *elemento = filaComMutex.desenfileirar();
+                    if (elemento != nullptr)
+                    {
+                        return elemento;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        });
+
+    std::cout << std::setw(10) << threads
+              << std::setw(14) << std::fixed << std::setprecision(1) << tempoSemTravas << " ns/par"
+              << std::setw(14) << tempoComMutex << " ns/par"
+              << (tempoSemTravas < 0 || tempoComMutex < 0 ? "  (erro: elemento perdido ou duplicado)" : "") << std::endl;
+
+    for (Elemento *elemento : lote)
+    {
+        delete elemento;
+    }
+}
+
+/**
+ * Compara a vazão entre duas threads da FilaSPSC (sem travas) com a de uma
+ * FilaOtimizada protegida por um mutex, limitada à mesma capacidade
+ * @param quantidade Número de elementos transferidos
+ */
+void medirFilaEntreThreads(int quantidade)
+{
+    const int capacidade = 1024;
+    std::vector<Elemento *> lote(capacidade);
+    for (int i = 0; i < capacidade; i++)
+    {
+        lote[i] = new Produto(i, "Produto", 1.0, 1);
+    }
+
+    FilaSPSC filaSemTravas(capacidade);
+    double tempoSemTravas = medirProdutorConsumidor(
+        quantidade, lote,
+        [&](Elemento *elemento)
+        { return filaSemTravas.enfileirar(elemento); },
+        [&]()
+        { return filaSemTravas.desenfileirar(); });
+
+    FilaOtimizada filaComMutex(capacidade);
+    std::mutex mutex;
+    double tempoComMutex = medirProdutorConsumidor(
+        quantidade, lote,
+        [&](Elemento *elemento)
+        {
+            std::lock_guard<std::mutex> trava(mutex);
+            return filaComMutex.getTamanho() < capacidade && filaComMutex.enfileirar(elemento);
+        },
+        [&]()
+        {
+            std::lock_guard<std::mutex> trava(mutex);
+            return filaComMutex.desenfileirar();
+        });
+
+    std::cout << std::setw(10) << quantidade
+              << std::setw(14) << std::fixed << std::setprecision(1) << tempoSemTravas << " ns/elem"
+              << std::setw(14) << tempoComMutex << " ns/elem"
+              << (tempoSemTravas < 0 || tempoComMutex < 0 ? "  (erro: ordem FIFO violada)" : "") << std::endl;
+
+    for (Elemento *elemento : lote)
+    {
+        delete elemento;
+    }
+}
+
+/**
+ * Função principal do programa de medição
+ */
+int main(int argc, char *argv[])
+{
+    int tamanhoMaximo = 10000000;
+    if (argc > 1)
+    {
+        tamanhoMaximo = std::atoi(argv[1]);
+        if (tamanhoMaximo < 10)
+        {
+            std::cerr << "Uso: " << argv[0] << " [tamanhoMaximo >= 10]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Suíte por operação: tempos por operação em ns (mediana e p99 das amostras)" << std::endl;
+    executarSuite(tamanhoMaximo);
+
+    // Cada experimento tem o seu limite, mas nenhum passa de tamanhoMaximo
+    // (os que começam acima dele ficam sem linhas)
+
+    imprimirSeparador("LISTA NÃO ORDENADA - INSERÇÃO NO FINAL");
+    for (int quantidade = 1000; quantidade <= std::min(10000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirInsercaoNoFinal(quantidade);
+    }
+
+    imprimirSeparador(std::string("LISTA NÃO ORDENADA - BUSCA LINEAR (") +
+                      OperacoesVetoriais::conjuntoInstrucoes() + ")");
+    for (int quantidade = 1000; quantidade <= std::min(1000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirBuscaLinear(quantidade);
+    }
+
+    imprimirSeparador("LISTA NÃO ORDENADA - REMOÇÃO PELO ID (COM ÍNDICE)");
+    for (int quantidade = 1000; quantidade <= std::min(1000000, tamanhoMaximo); quantidade *= 10)
+    {
+        // Preservar a ordem é quadrático: acima de 10^4 elementos leva minutos
+        if (quantidade <= 10000)
+        {
+            medirRemocaoPeloId(quantidade, ListaNaoOrdenada::PRESERVAR_ORDEM);
+        }
+        medirRemocaoPeloId(quantidade, ListaNaoOrdenada::TROCAR_COM_ULTIMO);
+    }
+
+    imprimirSeparador("LISTA ORDENADA - CARGA INDIVIDUAL x EM LOTE");
+    std::cout << std::setw(10) << "n" << std::setw(17) << "individual" << std::setw(17) << "lote" << std::endl;
+    for (int quantidade = 1000; quantidade <= std::min(1000000, tamanhoMaximo); quantidade *= 10)
+    {
+        // A carga individual é quadrática: acima de 10^5 elementos leva minutos
+        medirCargaOrdenada(quantidade, quantidade <= 100000);
+    }
+
+    imprimirSeparador("LISTA ORDENADA - INSERÇÃO INDIVIDUAL COM BUFFER DE ESCRITA");
+    std::cout << std::setw(10) << "n" << std::setw(20) << "sem buffer" << std::setw(20) << "com buffer"
+              << std::setw(20) << "busca (buffer)" << std::endl;
+    for (int quantidade = 1000; quantidade <= std::min(1000000, tamanhoMaximo); quantidade *= 10)
+    {
+        // Sem buffer, a inserção é quadrática: acima de 10^5 elementos leva minutos
+        medirBufferEscrita(quantidade, quantidade <= 100000);
+    }
+
+    imprimirSeparador("LISTA ORDENADA x LISTA ORDENADA ESPARSA (PMA) - OPERAÇÕES INDIVIDUAIS");
+    std::cout << std::setw(10) << "n" << std::setw(20) << "inserir (array)" << std::setw(20) << "remover (array)"
+              << std::setw(20) << "inserir (PMA)" << std::setw(20) << "remover (PMA)" << std::endl;
+    for (int quantidade = 1000; quantidade <= std::min(1000000, tamanhoMaximo); quantidade *= 10)
+    {
+        // No array contíguo, cada operação é O(n): acima de 10^5 elementos leva minutos
+        medirListaEsparsa(quantidade, quantidade <= 100000);
+    }
+
+    imprimirSeparador("LISTA ORDENADA - ATUALIZAÇÃO COM LOTE DE n/10 ELEMENTOS");
+    std::cout << std::setw(10) << "n" << std::setw(17) << "individual" << std::setw(17) << "mesclar"
+              << std::setw(17) << "lote ordenado" << std::endl;
+    for (int quantidade = 1000; quantidade <= std::min(10000000, tamanhoMaximo); quantidade *= 10)
+    {
+        // A inserção individual é quadrática: acima de 10^5 elementos leva minutos
+        medirMesclagem(quantidade, quantidade <= 100000);
+    }
+
+    imprimirSeparador("CONSULTA POR INTERVALO (100 ELEMENTOS POR CONSULTA)");
+    std::cout << std::setw(10) << "n" << std::setw(18) << "100 buscas" << std::setw(18) << "lista: visão"
+              << std::setw(18) << "árvore: podada" << std::endl;
+    for (int quantidade = 1000; quantidade <= std::min(1000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirBuscaIntervalo(quantidade);
+    }
+
+    imprimirSeparador("CARGA POR PONTEIRO x POR VALOR (PRODUTO)");
+    std::cout << std::setw(10) << "n" << std::setw(20) << "ListaNaoOrdenada" << std::setw(20) << "ListaSequencial" << std::endl;
+    for (int quantidade = 1000; quantidade <= std::min(1000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirCargaPorValor(quantidade);
+    }
+
+    imprimirSeparador("VARREDURA COM ITERADORES: POR PONTEIRO x POR VALOR");
+    std::cout << std::setw(10) << "n" << std::setw(22) << "ListaNaoOrdenada" << std::setw(22) << "ListaSequencial" << std::endl;
+    for (int quantidade = 1000; quantidade <= std::min(1000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirVarredura(quantidade);
+    }
+
+    imprimirSeparador("LISTA ORDENADA - BUSCA BINÁRIA x RETRATO CONGELADO (EYTZINGER) x ÍNDICE K-ÁRIO");
+    std::cout << std::setw(10) << "n" << std::setw(23) << "ListaOrdenada" << std::setw(23) << "congelar()"
+              << std::setw(23) << "índice k-ário" << std::endl;
+    for (int quantidade = 10000; quantidade <= std::min(10000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirBuscaCongelada(quantidade);
+    }
+
+    imprimirSeparador("LISTA ORDENADA - BUSCA BINÁRIA x ÍNDICE APRENDIDO (IDS QUASE SEQUENCIAIS)");
+    std::cout << std::setw(10) << "n" << std::setw(23) << "busca binária" << std::setw(23) << "índice aprendido"
+              << std::setw(10) << "trechos" << std::setw(15) << "construção" << std::endl;
+    for (int quantidade = 10000; quantidade <= std::min(10000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirIndiceAprendido(quantidade);
+    }
+
+    imprimirSeparador(std::string("LISTA ORDENADA - INTERSEÇÃO (") + OperacoesVetoriais::conjuntoInstrucoes() + " / GALOPE)");
+    std::cout << std::setw(10) << "n" << std::setw(17) << "n x n: busca" << std::setw(17) << "intersecao"
+              << std::setw(17) << "n/1000: busca" << std::setw(17) << "intersecao" << std::endl;
+    for (int quantidade = 10000; quantidade <= std::min(10000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirOperacoesConjunto(quantidade);
+    }
+
+    imprimirSeparador("FILA ENTRE DUAS THREADS - FilaSPSC x FilaOtimizada COM MUTEX (NÚCLEOS: " +
+                      std::to_string(std::thread::hardware_concurrency()) + ")");
+    std::cout << std::setw(10) << "n" << std::setw(22) << "FilaSPSC" << std::setw(22) << "mutex" << std::endl;
+    for (int quantidade = 100000; quantidade <= std::min(10000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirFilaEntreThreads(quantidade);
+    }
+
+    imprimirSeparador("FILA MPMC - THREADS PRODUTORAS E CONSUMIDORAS (NÚCLEOS: " +
+                      std::to_string(std::thread::hardware_concurrency()) + ")");
+    std::cout << std::setw(10) << "threads" << std::setw(21) << "FilaMPMC" << std::setw(21) << "mutex" << std::endl;
+    int maximoThreads = std::max(4, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int threads = 1; threads <= maximoThreads; threads *= 2)
+    {
+        medirFilaMPMC(threads);
+    }
+
+    imprimirSeparador("FILA BLOQUEANTE - CONSULTA EM LAÇO x ESPERA x LOTE DE 64");
+    std::cout << std::setw(10) << "n" << std::setw(22) << "filaVazia() em laço" << std::setw(22) << "desenfileirar"
+              << std::setw(22) << "desenfileirarLote" << std::setw(14) << "consultas" << std::setw(14) << "por lote"
+              << std::endl;
+    for (int quantidade = 100000; quantidade <= std::min(1000000, tamanhoMaximo); quantidade *= 10)
+    {
+        medirFilaBloqueante(quantidade);
+    }
+
+    return 0;
+}
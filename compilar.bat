@@ -4,7 +4,7 @@ REM Compila todos os arquivos necessários
 
 echo Compilando projeto AED...
 
-g++ -std=c++11 -o programa.exe main.cpp Pessoa.cpp Produto.cpp ListaNaoOrdenada.cpp ListaOrdenada.cpp Pilha.cpp Fila.cpp FilaOtimizada.cpp ListaSimplesmenteEncadeada.cpp ListaDuplamenteEncadeada.cpp ListaDuplamenteEncadeadaCircular.cpp PilhaEncadeada.cpp FilaEncadeada.cpp Deque.cpp ArvoreBinariaBusca.cpp
+g++ -std=c++14 -pthread -o programa.exe main.cpp Pessoa.cpp Produto.cpp ListaNaoOrdenada.cpp IndiceHash.cpp IndiceKario.cpp OperacoesVetoriais.cpp ListaOrdenada.cpp ListaOrdenadaCongelada.cpp ListaOrdenadaEsparsa.cpp Pilha.cpp Fila.cpp FilaOtimizada.cpp FilaSPSC.cpp FilaMPMC.cpp ListaSimplesmenteEncadeada.cpp ListaDuplamenteEncadeada.cpp ListaDuplamenteEncadeadaCircular.cpp PilhaEncadeada.cpp FilaEncadeada.cpp FilaBloqueante.cpp Deque.cpp ArvoreBinariaBusca.cpp
 
 if %errorlevel% == 0 (
     echo ✅ Compilação concluída com sucesso!
@@ -5,20 +5,28 @@
 
 echo "Compilando projeto AED..."
 
-g++ -std=c++11 -o programa \
+g++ -std=c++14 -pthread -o programa \
     main.cpp \
     Pessoa.cpp \
     Produto.cpp \
     ListaNaoOrdenada.cpp \
+    IndiceHash.cpp \
+    IndiceKario.cpp \
+    OperacoesVetoriais.cpp \
     ListaOrdenada.cpp \
+    ListaOrdenadaCongelada.cpp \
+    ListaOrdenadaEsparsa.cpp \
     Pilha.cpp \
     Fila.cpp \
     FilaOtimizada.cpp \
+    FilaSPSC.cpp \
+    FilaMPMC.cpp \
     ListaSimplesmenteEncadeada.cpp \
     ListaDuplamenteEncadeada.cpp \
     ListaDuplamenteEncadeadaCircular.cpp \
     PilhaEncadeada.cpp \
     FilaEncadeada.cpp \
+    FilaBloqueante.cpp \
     Deque.cpp \
     ArvoreBinariaBusca.cpp
 
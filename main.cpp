@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
@@ -9,6 +10,8 @@
 // Includes das estruturas com alocação sequencial
 #include "ListaNaoOrdenada.h"
 #include "ListaOrdenada.h"
+#include "ListaOrdenadaEsparsa.h"
+#include "ListaSequencial.h"
 #include "Pilha.h"
 #include "Fila.h"
 #include "FilaOtimizada.h"
@@ -123,6 +126,80 @@ void demonstrarEstruturasSequenciais()
         encontrado->imprimirInfo();
     }
 
+    // Consulta por intervalo: uma visão do próprio array, sem cópias
+    std::cout << "\nElementos com ID entre 15 e 35:" << std::endl;
+    for (Elemento *elemento : listaOrdenada.buscarIntervalo(15, 35))
+    {
+        elemento->imprimirInfo();
+    }
+
+    // Estatísticas de ordem: a lista já está ordenada, sem cópias
+    std::cout << "\nIDs menores que 35: " << listaOrdenada.rank(35) << std::endl;
+    std::cout << "Mediana: ";
+    listaOrdenada.percentil(50)->imprimirInfo();
+    std::cout << "Menor e maior ID: " << listaOrdenada.primeiro()->getID() << " e "
+              << listaOrdenada.ultimo()->getID() << std::endl;
+
+    // Retrato imutável para consultas (layout de Eytzinger)
+    std::unique_ptr<ListaOrdenadaCongelada> retrato(listaOrdenada.congelar());
+    if (retrato)
+    {
+        std::cout << "\nBusca no retrato congelado (" << retrato->getTamanho() << " elementos, ID 50): ";
+        Elemento *noRetrato = retrato->buscarPeloId(50);
+        if (noRetrato)
+        {
+            noRetrato->imprimirInfo();
+        }
+    }
+
+    // Com o buffer de escrita, as inserções ficam pendentes; uma lista const é
+    // percorrida intercalando o array e o buffer, sem descarregá-lo
+    listaOrdenada.ativarBufferEscrita();
+    listaOrdenada.inserirNoFinal(new Pessoa(40, "Débora", 26));
+    listaOrdenada.inserirNoFinal(new Pessoa(5, "Eduardo", 19));
+    const ListaOrdenada &somenteLeitura = listaOrdenada;
+    std::cout << "\nIDs com duas inserções pendentes no buffer:";
+    for (const Elemento *elemento : somenteLeitura)
+    {
+        std::cout << " " << elemento->getID();
+    }
+    std::cout << std::endl;
+
+    // Lista Ordenada Esparsa (Packed Memory Array)
+    std::cout << "\n=== TESTANDO LISTA ORDENADA ESPARSA (PMA) ===" << std::endl;
+    ListaOrdenadaEsparsa listaEsparsa;
+    for (int id = 100; id >= 10; id -= 10)
+    {
+        listaEsparsa.inserirNoFinal(new Produto(id, "Peça", id * 1.5, id / 10));
+    }
+    delete listaEsparsa.removerPeloId(40);
+    listaEsparsa.imprimirTodos();
+
+    pausar();
+
+    // Lista Sequencial por valor
+    std::cout << "\n=== TESTANDO LISTA SEQUENCIAL POR VALOR ===" << std::endl;
+    ListaSequencial<Pessoa> listaPorValor;
+
+    // Os objetos são construídos diretamente no bloco da lista, sem new
+    listaPorValor.construirNoFinal(60, "Daniel", 27);
+    listaPorValor.inserirNoFinal(Pessoa(70, "Elisa", 31));
+    listaPorValor.inserirNoInicio(Pessoa(80, "Fábio", 45));
+    listaPorValor.imprimirTodos();
+
+    Pessoa removida(0, "", 0);
+    if (listaPorValor.removerPeloId(70, &removida))
+    {
+        std::cout << "\nRemovida pelo ID 70: ";
+        removida.imprimirInfo();
+    }
+
+    // O lote pode vir da própria lista, mesmo que ela precise crescer para recebê-lo
+    listaPorValor.encolher();
+    listaPorValor.inserirVarios(listaPorValor.dados(), listaPorValor.getTamanho());
+    std::cout << "\nApós duplicar a lista com inserirVarios(dados(), getTamanho()):" << std::endl;
+    listaPorValor.imprimirTodos();
+
     pausar();
 
     // Pilha
@@ -162,7 +239,7 @@ void demonstrarEstruturasSequenciais()
     fila.imprimirFila();
 
     std::cout << "\n=== TESTANDO FILA OTIMIZADA (FIFO) ===" << std::endl;
-    FilaOtimizada filaOtimizada;
+    FilaOtimizada filaOtimizada(2); // Começa com 2 posições e dobra ao encher
 
     filaOtimizada.enfileirar(new Pessoa(301, "Cliente A", 28));
     filaOtimizada.enfileirar(new Pessoa(302, "Cliente B", 33));
@@ -220,6 +297,14 @@ void demonstrarEstruturasEncadeadas()
     std::cout << "\nLista duplamente encadeada (fim → início):" << std::endl;
     listaDupla.imprimirTodosReverso();
 
+    // Remoção por predicado em uma única passada
+    int removidos = listaDupla.removerSe([](const Elemento *elemento)
+                                         {
+                                             const Produto *produto = dynamic_cast<const Produto *>(elemento);
+                                             return produto != nullptr && produto->getQuantidade() < 45; });
+    std::cout << "\nRemovidos " << removidos << " produtos com quantidade < 45:" << std::endl;
+    listaDupla.imprimirTodos();
+
     pausar();
 
     // Lista Duplamente Encadeada Circular
@@ -372,6 +457,22 @@ void demonstrarArvoreBinariaBusca()
     std::cout << "\nÁrvore após remoção (percurso em ordem):" << std::endl;
     arvore.emOrdem();
 
+    // Percorre a árvore sem imprimir: iterador em ordem e visitante
+    std::cout << "\n=== PERCORRENDO A ÁRVORE SEM IMPRESSÃO ===" << std::endl;
+    int acimaDe45 = static_cast<int>(std::count_if(arvore.begin(), arvore.end(), [](const Elemento *elemento)
+                                                   { return elemento->getID() > 45; }));
+    int somaIds = 0;
+    arvore.paraCada([&somaIds](const Elemento *elemento)
+                    { somaIds += elemento->getID(); });
+    std::cout << "Elementos com ID > 45: " << acimaDe45 << std::endl;
+    std::cout << "Soma dos IDs: " << somaIds << std::endl;
+
+    // Consulta por intervalo: só as subárvores que cruzam [45, 75] são visitadas
+    std::cout << "\nElementos com ID entre 45 e 75:" << std::endl;
+    int noIntervalo = arvore.buscarIntervalo(45, 75, [](const Elemento *elemento)
+                                             { elemento->imprimirInfo(); });
+    std::cout << "Total no intervalo: " << noIntervalo << std::endl;
+
     pausar();
 }
 